@@ -4,33 +4,66 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
+../src/arena.cpp \
+../src/entities.cpp \
 ../src/galaxy.cpp \
 ../src/graphics.cpp \
+../src/jobs.cpp \
 ../src/language.cpp \
+../src/loader.cpp \
 ../src/main.cpp \
+../src/mask.cpp \
 ../src/object.cpp \
+../src/pack.cpp \
+../src/placement.cpp \
+../src/random.cpp \
+../src/renderlist.cpp \
 ../src/shoot.cpp \
+../src/shotcache.cpp \
 ../src/sound.cpp \
+../src/tasks.cpp \
 ../src/vector_2.cpp 
 
 OBJS += \
+./src/arena.o \
+./src/entities.o \
 ./src/galaxy.o \
 ./src/graphics.o \
+./src/jobs.o \
 ./src/language.o \
+./src/loader.o \
 ./src/main.o \
+./src/mask.o \
 ./src/object.o \
+./src/pack.o \
+./src/placement.o \
+./src/random.o \
+./src/renderlist.o \
 ./src/shoot.o \
+./src/shotcache.o \
 ./src/sound.o \
+./src/tasks.o \
 ./src/vector_2.o 
 
 CPP_DEPS += \
+./src/arena.d \
+./src/entities.d \
 ./src/galaxy.d \
 ./src/graphics.d \
+./src/jobs.d \
 ./src/language.d \
+./src/loader.d \
 ./src/main.d \
+./src/mask.d \
 ./src/object.d \
+./src/pack.d \
+./src/placement.d \
+./src/random.d \
+./src/renderlist.d \
 ./src/shoot.d \
+./src/shotcache.d \
 ./src/sound.d \
+./src/tasks.d \
 ./src/vector_2.d 
 
 
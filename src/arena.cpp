@@ -0,0 +1,114 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "arena.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <iostream>
+#include <stdlib.h>
+
+#include "arena.hpp"
+
+const size_t ARENAALIGN = 16;
+
+/******************************************************************************************
+ *
+ * Arena
+ *
+ ******************************************************************************************/
+Arena::Arena( size_t block_size )
+:
+	block_size(block_size),
+	block(0),
+	offset(0),
+	used(0),
+	high_water(0)
+{
+	verbose( "Initializing Arena" );
+}
+
+Arena::~Arena()
+{
+	verbose( "Deleting Arena" );
+
+	reset();
+
+	for ( int i=0; i < (int)blocks.size(); i++ )
+		free( blocks[i].data );
+}
+
+void *Arena::allocate( size_t size )
+{
+	size = ( size + ARENAALIGN-1 ) & ~( ARENAALIGN-1 );
+
+	// Find the next Block with enough Room. Skipped Rest is lost until reset().
+	while ( block < (int)blocks.size() && offset + size > blocks[block].size ) {
+		block++;
+		offset = 0;
+	}
+
+	if ( block == (int)blocks.size() ) {
+		Block b;
+
+		b.size = ( size > block_size ) ? size : block_size;
+		b.data = (char *)malloc( b.size );
+
+		if ( b.data == NULL ) {
+			std::cout << "Error in Arena: Out of Memory." << std::endl;
+			exit(1);
+		}
+
+		blocks.push_back( b );
+		offset = 0;
+	}
+
+	void *memory = blocks[block].data + offset;
+
+	offset += size;
+	used += size;
+
+	if ( used > high_water )
+		high_water = used;
+
+	return memory;
+}
+
+void Arena::reset()
+{
+	for ( int i = (int)destructors.size()-1; i >= 0; i-- )
+		destructors[i].destroy( destructors[i].object );
+
+	destructors.clear();
+	block = 0;
+	offset = 0;
+	used = 0;
+}
+
+size_t Arena::get_Used() const
+{
+	return used;
+}
+
+size_t Arena::get_HighWater() const
+{
+	return high_water;
+}
@@ -0,0 +1,110 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "arena.hpp"
+ *
+ * Arena - Memory for Objects that live as long as a Galaxy. Objects
+ * are put one after another into big Blocks; reset() runs their
+ * Destructors and starts again at the first Block, so a new Galaxy
+ * needs (nearly) no Calls to new and delete.
+ *
+ * Use it like this:
+ *
+ * Stone *stone = arena->own( new ( *arena ) Stone( arena, seed ) );
+ *
+ * Never delete an Object of the Arena.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __ARENA_HPP__
+#define __ARENA_HPP__
+
+#include <vector>
+#include <new>
+#include <stddef.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Arena
+ *
+ ******************************************************************************************/
+class Arena
+{
+public:
+	Arena( size_t block_size = ARENABLOCKSIZE );
+
+	~Arena();
+
+	// Returns aligned Memory that is valid until reset()
+	void *allocate( size_t size );
+
+	// The Destructor of object is called at reset(), newest first
+	template<class T> T *own( T *object )
+	{
+		Destructor destructor = { &Arena::destroy<T>, object };
+		destructors.push_back( destructor );
+
+		return object;
+	}
+
+	void reset();
+
+	// Bytes used by Objects since the last reset()
+	size_t get_Used() const;
+
+	// The most Bytes that were ever used at the same time
+	size_t get_HighWater() const;
+
+private:
+	struct Block {
+		char *data;
+		size_t size;
+	};
+
+	struct Destructor {
+		void (*destroy)( void *object );
+		void *object;
+	};
+
+	std::vector<Block> blocks;
+	std::vector<Destructor> destructors;
+	size_t block_size;
+	int block;
+	size_t offset;
+	size_t used, high_water;
+
+	template<class T> static void destroy( void *object )
+	{
+		( (T *)object )->~T();
+	}
+};
+
+inline void *operator new( size_t size, Arena &arena )
+{
+	return arena.allocate( size );
+}
+
+// Only called if a Constructor throws
+inline void operator delete( void *, Arena & ) {}
+
+#endif
@@ -32,6 +32,8 @@
 
 #include <SDL/SDL.h>
 
+#include "random.hpp"
+
 //#define __DEBUG__		// Print out Some Debug Information
 //#define __TRAINERMODE__	// Show Shootpath, toggle Weapon
 //#define __THREADS__		// Tested Threads... didn't work faster =( 
@@ -50,8 +52,11 @@ const int SCREENHEIGHT 		= 768;
 const int BORDERWIDTH 		= 70;
 const int SCROLLBORDERWIDTH 	= 20;		// Screen scrolls if shoot is above that line  
 const int SCROLLBACKSPEED 	= 10;  		// Steps to scroll back Screen
-const int TICK_INTERVAL_SCREEN 	= 30; 
-const int TICK_INTERVAL_GAME 	= 30; 
+const int TICK_INTERVAL_SCREEN 	= 10; 		// Shortest Time between two drawn Frames (ms)
+const int TICK_INTERVAL_GAME 	= 30; 		// One Step of the Game (ms), however fast it is drawn
+const int MAXCATCHUP 		= 5;		// Steps a slow Computer makes up before the next Frame
+const int FASTFORWARD 		= 8;		// Steps per Step while Fast-Forward is pressed
+const int PRESENTREPORT 	= 300;		// Frames between two Reports of the Flip-Time (--verbose)
 const int ANIMFRAME 		= 3;		// Normal nth Frame is next Anim
 const int BLINKTIME 		= 45;		// For flashing Text
 const int SCROLLERSPEED 	= 4;
@@ -65,11 +70,13 @@ const int KEY_MOVEDOWN 		= SDLK_DOWN;
 const int KEY_FIRE 		= SDLK_SPACE;
 const int KEY_QUIT 		= SDLK_ESCAPE;
 const int KEY_WARPGALAXY 	= SDLK_TAB;
+const int KEY_TOGGLEGALAXYTYPE 	= SDLK_g;
 const int KEY_CHOOSEBONUS 	= SDLK_RETURN;
 const int KEY_TOGGLEFULLSCREEN 	= SDLK_f;
 const int KEY_TOGGLESCROLLER 	= SDLK_F1;
 const int KEY_TOGGLELANGUAGE 	= SDLK_F2;
 const int KEY_SCREENSHOT 	= SDLK_F12;
+const int KEY_FASTFORWARD 	= SDLK_x;
 const int UKEY_ONEPLAYER 	= 48+1;		// For french Keyboard
 const int UKEY_TWOPLAYER 	= 48+2;
 const int UKEY_DEMO 		= 48+3;
@@ -79,7 +86,11 @@ const int KEY_TOGGLEHINT 	= SDLK_h;	// undocumented feature, built in for testin
 const int KEY_NEXTWEAPON 	= SDLK_n;	// undocumented feature, built in for testing only...  = )
 
 // GAME+GALAXY
-const int MAXPLAYER 		= 2;		// Don't change! (Actually?) only 2 Players are supported
+const int MAXPLAYER 		= 16;		// Flying Saucers in a Game (see --players)
+const int MAXUFOSINCOLUMN 	= 4;		// More Saucers on a Side stand in two Columns
+const int UFOCOLUMNGAP 		= 80;		// Pixels between the two Columns of a Side
+const int UFOHEIGHT 		= 80;		// Drawn Height of a Saucer, Neighbours keep it apart
+const int MINPLAYER 		= 2;
 const int MAXENERGY 		= 100;
 const int WINNINGWAIT 		= 400;		// Frames to wait if Game has a Winner
 
@@ -101,6 +112,13 @@ enum WeaponId {
 // PLANETS
 const int MAXPLANETS 		= 9;		// max. Planets in a Galaxy
 const int MINPLANETS 		= 5;		// min. -"-
+const int MAXGALAXYOBJECTS 	= 512;		// Room for Planets in a Galaxy
+const int MAXPLACEMENTDARTS 	= 30;		// Tries to find a free Place for one Object
+const int ARENABLOCKSIZE 	= 65536;	// Bytes, Memory for the Objects of a Galaxy
+const int GRIDCELLSIZE 		= 64;		// Pixels, Cells for Collision-Queries
+const int GRAVITYTREEMIN 	= 32;		// With less Objects Gravity is taken directly
+const int GRAVITYTREEDEPTH 	= 24;		// Quadtree for Gravity
+const double GRAVITYTHETA 	= 0.5;		// Smaller is exacter, but slower
 const int WEIGHT_JUPITER 	= 350;		// Weight is important for the gravity!
 const int WEIGHT_EARTH 		= 300;
 const int WEIGHT_MARS 		= 200;
@@ -108,21 +126,40 @@ const int WEIGHT_VENUS 		= 180;
 const int WEIGHT_SATURN	 	= 250;
 const int WEIGHT_BLACKHOLE 	= -100;
 const int WEIGHT_WORMHOLE 	= 100;
+const int WEIGHT_ASTEROID 	= 3;
+const int MAXASTEROIDS 		= 500;		// max. Asteroids in an Asteroid-Field
+const int MINASTEROIDS 		= 300;		// min. -"-
 const int MAXSTONES 		= 35;
+const int MAXORBIT 		= 360;		// Ticks of the slowest Stone for one Orbit
+const int MAXEPHEMERIS 		= 4096;		// Ticks of the slowest Planet for one Orbit
+const int ORBITPERIOD 		= 600;		// Ticks for one Orbit with a Radius of 100
+const int ORBITGAP 		= 20;		// Pixels between the Orbits of two Planets
 
 // SHOOT
-const int MAXSHOOTS 		= 1;		// Shoots per Player (Don't change!)
+const int MAXPROJECTILES 	= 32;		// Shoots and Cluster-Lasers flying at the same Time
+const int MAXEXPLOSIONS 	= 8;		// Explosions shown at the same Time
 const int MAXSHOOTPOWER 	= 100;		// 1..100
 const int SHOOTPOWERFACTOR 	= 3;
-const int MAXSHOOTRUN 		= 700;		// max. Frames a Shoot should run
-const int SHOOT_INTERVAL 	= 30; 
+const int MAXSHOOTRUN 		= 700;		// max. Steps a Shoot should run
+const int SHOOT_INTERVAL 	= TICK_INTERVAL_GAME; 	// A Shoot flies one Step of the Game per Move
 
 // COMPUTER
 const int MAXCOMPUTERSEARCH 	= 150; 		// Amount of paths the computer explores for shooting.
+const int MAXCOMPUTERRECHECKS 	= 3;		// New Searches when a Hit misses after aiming
 const int MAXPRECALC 		= MAXSHOOTRUN;	// How deep should the computer think.
+const int COARSESTEPS 		= 4;		// Steps in one for the first Look at a Path
+const int COARSEMARGIN 		= 3;		// Times the Aim of the Computer, taken as promising
+const double COARSETHETA 	= 1.0;		// Gravity of far Planets is taken together
+const int MAXHINTS 		= 5;		// Power-Levels of the Hint (see --hints)
+const int HINTCHECKSTEPS 	= 32;		// Steps of the Hint between Looks for a newer Request
+const int MAXWORKERS 		= 16;		// Threads that help searching (see --workers)
+const int TASKBUDGET 		= 4;		// ms per Frame for Tasks like the Search (see --budget)
+const int MAXTASKBUDGET 	= 100;
 
 // SOUND
 const int NUMBEROFCHANNELS 	= 4;
+const int AUDIOFREQUENCY 	= 22050;	// Mixer rate, all Samples are converted to it
+const int AUDIOCHANNELS 	= 2;
 static const int _SOUNDSETNAMES = 8;
 enum SoundId {
 	SOUND_EXPLOSION   = 0,
@@ -135,9 +172,48 @@ enum SoundId {
 	SOUND_BUYWEAPON   = 7
 };
 
+static const char *const SOUNDSETNAMES[_SOUNDSETNAMES] = { 
+	"snd/explosion.wav",	// 0
+	"snd/laser.wav",    	// 1
+	"snd/applause.wav",	// 2
+	"snd/curve.wav", 	// 3
+	"snd/kling.wav", 	// 4
+	"snd/pluck.wav", 	// 5
+	"snd/strom.wav",	// 6
+	"snd/click.wav" };	// 7
+
+// GRAPHICS. Every Picture that is loaded as Sprite or Font:
+static const int _GFXNAMES = 29;
+static const char *const GFXNAMES[_GFXNAMES] = {
+	"gfx/c_shooting.gif", "gfx/c_thinking.gif", "gfx/cpktblue.gif", "gfx/cpktred.gif",
+	"gfx/earth.gif", "gfx/explosionanim.gif", "gfx/extra.gif", "gfx/extra0.gif",
+	"gfx/extra1.gif", "gfx/extra2.gif", "gfx/extra3.gif", "gfx/font.gif",
+	"gfx/heavy.gif", "gfx/heavyback.gif", "gfx/heavybackk.gif", "gfx/hole.gif",
+	"gfx/jupiter.gif", "gfx/mars.gif", "gfx/moon.gif", "gfx/moon_mask.gif",
+	"gfx/saturn.gif", "gfx/shoot.gif", "gfx/shootback.gif", "gfx/shootbackk.gif",
+	"gfx/stone.gif", "gfx/stone_mask.gif", "gfx/ufoblue.gif", "gfx/ufored.gif",
+	"gfx/venus.gif" };
+
+// PACK
+const std::string PACKFILE 	= "highmoon.pak";	// Build with "make pack" (see Makefile)
+
+// SHOTCACHE
+const std::string SHOTCACHEFILE = ".highmoon.cache";	// Hitting Shoots of the Computer
+const int SHOTCACHESLOTS 	= 8192;
+const int SHOTCACHEPROBES 	= 8;		// Slots tried for one Key
+const int SHOTCACHEBAND 	= 40;		// Pixels of y that share the same Shoots
+
 extern void verbose( std::string info );
 
-#define RANDOM(max,min) ((max-min)*(rand()/(RAND_MAX+1.0))+min)
+// min <= Number < max from the Streams of Random: RANDOM for the Game,
+// RANDOM_AI for the Computer, RANDOM_FX for what is only drawn
+#define RANDOM(max,min) (Random::world.get(max,min))
+#define RANDOM_AI(max,min) (Random::ai.get(max,min))
+#define RANDOM_FX(max,min) (Random::effects.get(max,min))
+
+// Same with an own Generator. Galaxies are created with it in the
+// Background, without touching the Streams of the Game.
+#define RANDOM_R(max,min,random) ((random)->get(max,min))
 
 #define SCREAM(t) std::cout << t << std::endl << std::flush;
 
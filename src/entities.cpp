@@ -0,0 +1,554 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "entities.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <cmath>
+#include <algorithm>
+
+#include "entities.hpp"
+#include "mask.hpp"
+
+/******************************************************************************************
+ *
+ * Entities
+ *
+ ******************************************************************************************/
+Entities::Entities()
+:
+	indexed(false)
+{
+	verbose( "Initializing Entities" );
+
+	columns = ( SCREENWIDTH + GRIDCELLSIZE-1 ) / GRIDCELLSIZE;
+	rows = ( SCREENHEIGHT + GRIDCELLSIZE-1 ) / GRIDCELLSIZE;
+}
+
+void Entities::clear()
+{
+	// Keeps the Memory for the next Frame
+	pos_x.clear();
+	pos_y.clear();
+	width.clear();
+	spacing.clear();
+	weight.clear();
+	kind.clear();
+	owner.clear();
+	children.clear();
+	objects.clear();
+	orbit_x.clear();
+	orbit_y.clear();
+	kept_orbits.clear();
+	period.clear();
+	phase.clear();
+	mask.clear();
+	bound_x.clear();
+	bound_y.clear();
+	bound_radius.clear();
+}
+
+int Entities::add( Spaceobject *object, Kind kind, double x, double y, 
+	double width, double spacing, double weight, int owner )
+{
+	pos_x.push_back( x );
+	pos_y.push_back( y );
+	this->width.push_back( width );
+	this->spacing.push_back( spacing );
+	this->weight.push_back( weight );
+	this->kind.push_back( kind );
+	this->owner.push_back( owner );
+	children.push_back( 0 );
+	objects.push_back( object );
+	orbit_x.push_back( NULL );
+	orbit_y.push_back( NULL );
+	period.push_back( 0 );
+	phase.push_back( 0 );
+	mask.push_back( NULL );
+
+	if ( owner >= 0 )
+		children[owner]++;
+
+	double radius = ( width + ( spacing > 0 ? spacing : 0 ) ) / 2;
+	bound_x.push_back( x );
+	bound_y.push_back( y );
+	bound_radius.push_back( radius > 0 ? radius : 0 );
+
+	return objects.size()-1;
+}
+
+int Entities::size() const
+{
+	return objects.size();
+}
+
+void Entities::set_Bounds( int index, double x, double y, double radius )
+{
+	bound_x[index] = x;
+	bound_y[index] = y;
+	bound_radius[index] = radius;
+}
+
+void Entities::set_Orbit( int index, const float *x, const float *y, int period, int phase )
+{
+	orbit_x[index] = x;
+	orbit_y[index] = y;
+	this->period[index] = period;
+	this->phase[index] = phase;
+}
+
+void Entities::keep_Orbits()
+{
+	int amount = 0;
+
+	for ( int i=0; i < size(); i++ )
+		if ( orbit_x[i] != NULL )
+			amount += 2*period[i];
+
+	// Copied from the old Table first, it may be kept_orbits itself
+	std::vector<float> kept( amount );
+	float *next = amount > 0 ? &kept[0] : NULL;
+
+	for ( int i=0; i < size(); i++ )
+		if ( orbit_x[i] != NULL ) {
+			std::copy( orbit_x[i], orbit_x[i] + period[i], next );
+			orbit_x[i] = next;
+			next += period[i];
+
+			std::copy( orbit_y[i], orbit_y[i] + period[i], next );
+			orbit_y[i] = next;
+			next += period[i];
+		}
+
+	// Swapping keeps the Pointers into the Buffer valid
+	kept_orbits.swap( kept );
+}
+
+void Entities::set_Mask( int index, const Mask *mask )
+{
+	this->mask[index] = mask;
+}
+
+void Entities::index()
+{
+	int amount = objects.size();
+
+	if ( indexed && amount == (int)indexed_x.size() ) {
+		bool moved = false;
+
+		for ( int i=0; i < amount && !moved; i++ )
+			moved = owner[i] < 0 && ( bound_x[i] != indexed_x[i] || bound_y[i] != indexed_y[i] 
+				|| bound_radius[i] != indexed_radius[i] );
+
+		if ( !moved )
+			return;
+	}
+
+	indexed_x = bound_x;
+	indexed_y = bound_y;
+	indexed_radius = bound_radius;
+
+	// Count the Entities of each Cell, then put them in
+	cell_start.assign( columns*rows + 1, 0 );
+
+	for ( int pass=0; pass < 2; pass++ ) {
+
+		for ( int i=0; i < amount; i++ ) {
+
+			if ( owner[i] >= 0 )
+				continue;
+
+			int c_1 = get_Column( bound_x[i] - bound_radius[i] ),
+				c_2 = get_Column( bound_x[i] + bound_radius[i] ),
+				r_1 = get_Row( bound_y[i] - bound_radius[i] ),
+				r_2 = get_Row( bound_y[i] + bound_radius[i] );
+
+			for ( int r = r_1; r <= r_2; r++ )
+				for ( int c = c_1; c <= c_2; c++ )
+					if ( pass == 0 )
+						cell_start[ r*columns + c + 1 ]++;
+					else
+						cell_entities[ cell_start[ r*columns + c ]++ ] = i;
+		}
+
+		if ( pass == 0 ) {
+			for ( int c=0; c < columns*rows; c++ )
+				cell_start[c+1] += cell_start[c];
+
+			cell_entities.resize( cell_start[columns*rows] );
+		} else {
+			// Filling moved each Start to the Start of the next Cell
+			for ( int c = columns*rows; c > 0; c-- )
+				cell_start[c] = cell_start[c-1];
+
+			cell_start[0] = 0;
+		}
+	}
+
+	build_Tree();
+
+	indexed = true;
+}
+
+int Entities::find_collision( double x, double y, double width, bool spacing, int ahead ) const
+{
+	int first = -1;
+
+	if ( !indexed || (int)indexed_x.size() != (int)objects.size() ) {
+
+		for ( int i=0; i < (int)objects.size() && first < 0; i++ )
+			if ( owner[i] < 0 )
+				first = find_in_Family( i, x, y, width, spacing, ahead );
+
+		return first;
+	}
+
+	double radius = ( width > 0 ) ? width/2 : 0;
+	int c_1 = get_Column( x - radius ),
+		c_2 = get_Column( x + radius ),
+		r_1 = get_Row( y - radius ),
+		r_2 = get_Row( y + radius );
+
+	// The first Entity counts (Planets before their Stones)
+	for ( int r = r_1; r <= r_2; r++ ) {
+		for ( int c = c_1; c <= c_2; c++ ) {
+			int end = cell_start[ r*columns + c + 1 ];
+
+			for ( int k = cell_start[ r*columns + c ]; k < end; k++ ) {
+				int i = cell_entities[k];
+
+				if ( first < 0 || i < first ) {
+					int hit = find_in_Family( i, x, y, width, spacing, ahead );
+
+					if ( hit >= 0 )
+						first = hit;
+				}
+			}
+		}
+	}
+
+	return first;
+}
+
+int Entities::find_Kind( Kind kind, double x, double y, double width, int *found, int max ) const
+{
+	int amount = 0;
+
+	if ( !indexed || (int)indexed_x.size() != (int)objects.size() ) {
+
+		for ( int i=0; i < (int)objects.size() && amount < max; i++ )
+			if ( kind == this->kind[i] && touches( i, x, y, width, false, 0 ) )
+				found[amount++] = i;
+
+		return amount;
+	}
+
+	double radius = ( width > 0 ) ? width/2 : 0;
+	int c_1 = get_Column( x - radius ),
+		c_2 = get_Column( x + radius ),
+		r_1 = get_Row( y - radius ),
+		r_2 = get_Row( y + radius );
+
+	for ( int r = r_1; r <= r_2; r++ ) {
+		for ( int c = c_1; c <= c_2; c++ ) {
+			int end = cell_start[ r*columns + c + 1 ];
+
+			for ( int k = cell_start[ r*columns + c ]; k < end && amount < max; k++ ) {
+				int i = cell_entities[k];
+				bool known = false;
+
+				if ( kind != this->kind[i] )
+					continue;
+
+				// Big Entities are in more than one Cell
+				for ( int j=0; j < amount && !known; j++ )
+					known = found[j] == i;
+
+				if ( !known && touches( i, x, y, width, false, 0 ) )
+					found[amount++] = i;
+			}
+		}
+	}
+
+	return amount;
+}
+
+void Entities::add_Gravity( double x, double y, double &gx, double &gy, int ahead, double theta ) const
+{
+	bool tree = indexed && (int)indexed_x.size() == (int)objects.size();
+	int amount = ( tree ) ? direct.size() : objects.size();
+
+	// Pull is Weight/Distance towards the Entity
+	for ( int k=0; k < amount; k++ ) {
+		int i = ( tree ) ? direct[k] : k;
+
+		if ( weight[i] == 0 )
+			continue;
+
+		double dx, dy;
+
+		get_Position( i, ahead, dx, dy );
+		dx -= x;
+		dy -= y;
+
+		double distance2 = dx*dx + dy*dy;
+
+		if ( distance2 > 0 ) {
+			gx += dx * weight[i] / distance2;
+			gy += dy * weight[i] / distance2;
+		}
+	}
+
+	if ( !tree || nodes.empty() )
+		return;
+
+	int stack[ 3*GRAVITYTREEDEPTH + 4 ];
+	int top = 0;
+
+	stack[top++] = 0;
+
+	while ( top > 0 ) {
+		const Node &node = nodes[ stack[--top] ];
+		double dx = node.mass_x - x,
+			dy = node.mass_y - y,
+			distance2 = dx*dx + dy*dy;
+
+		if ( node.child < 0 || node.size*node.size < theta*theta*distance2 ) {
+
+			if ( distance2 > 0 ) {
+				gx += dx * node.weight / distance2;
+				gy += dy * node.weight / distance2;
+			}
+		} else {
+			for ( int c=0; c < 4; c++ )
+				if ( nodes[ node.child+c ].count > 0 )
+					stack[top++] = node.child+c;
+		}
+	}
+}
+
+void Entities::build_Tree()
+{
+	int amount = objects.size();
+	double left = 0, top = 0, right = 0, bottom = 0;
+	int pulling = 0;
+
+	nodes.clear();
+	direct.clear();
+
+	for ( int i=0; i < amount; i++ )
+		if ( weight[i] > 0 )
+			pulling++;
+
+	// Few Entities are faster without Tree. Negative Weights (Blackholes)
+	// have no Center of Mass, they always pull directly. So do Entities
+	// on an Orbit, the Tree is only built when Planets stand still.
+	for ( int i=0; i < amount; i++ ) {
+
+		if ( weight[i] == 0 )
+			continue;
+
+		if ( weight[i] < 0 || period[i] > 0 || pulling < GRAVITYTREEMIN ) {
+			direct.push_back( i );
+			continue;
+		}
+
+		if ( nodes.empty() ) {
+			Node root = { 0, 0, 0, 0, 0, 0, 0, -1, -1 };
+			nodes.push_back( root );
+			left = right = pos_x[i];
+			top = bottom = pos_y[i];
+		}
+
+		if ( pos_x[i] < left ) left = pos_x[i];
+		if ( pos_x[i] > right ) right = pos_x[i];
+		if ( pos_y[i] < top ) top = pos_y[i];
+		if ( pos_y[i] > bottom ) bottom = pos_y[i];
+	}
+
+	if ( nodes.empty() )
+		return;
+
+	nodes[0].x = left;
+	nodes[0].y = top;
+	nodes[0].size = ( ( right-left > bottom-top ) ? right-left : bottom-top ) + 1;
+
+	for ( int i=0; i < amount; i++ )
+		if ( weight[i] > 0 && period[i] == 0 && pulling >= GRAVITYTREEMIN )
+			insert( i );
+
+	for ( int n=0; n < (int)nodes.size(); n++ ) {
+		if ( nodes[n].weight > 0 ) {
+			nodes[n].mass_x /= nodes[n].weight;
+			nodes[n].mass_y /= nodes[n].weight;
+		}
+	}
+}
+
+void Entities::insert( int entity )
+{
+	double w = weight[entity];
+	int n = 0;
+
+	for ( int depth=0; ; depth++ ) {
+		nodes[n].mass_x += pos_x[entity] * w;
+		nodes[n].mass_y += pos_y[entity] * w;
+		nodes[n].weight += w;
+
+		if ( ++nodes[n].count == 1 ) {
+			nodes[n].entity = entity;
+			return;
+		}
+
+		if ( nodes[n].child < 0 ) {
+
+			// Entities at the same Place stay together
+			if ( depth >= GRAVITYTREEDEPTH ) {
+				nodes[n].entity = -1;
+				return;
+			}
+
+			// Split the Leaf and move its Entity down
+			int first = nodes.size();
+			double half = nodes[n].size/2;
+
+			for ( int c=0; c < 4; c++ ) {
+				Node child = { nodes[n].x + ( c%2 ) * half, nodes[n].y + ( c/2 ) * half, half, 
+					0, 0, 0, 0, -1, -1 };
+				nodes.push_back( child );
+			}
+
+			int old = nodes[n].entity;
+			int c = ( pos_x[old] >= nodes[n].x + half ) + 2 * ( pos_y[old] >= nodes[n].y + half );
+			Node &moved = nodes[ first+c ];
+
+			moved.mass_x = pos_x[old] * weight[old];
+			moved.mass_y = pos_y[old] * weight[old];
+			moved.weight = weight[old];
+			moved.count = 1;
+			moved.entity = old;
+
+			nodes[n].child = first;
+			nodes[n].entity = -1;
+		}
+
+		double half = nodes[n].size/2;
+		int c = ( pos_x[entity] >= nodes[n].x + half ) + 2 * ( pos_y[entity] >= nodes[n].y + half );
+
+		n = nodes[n].child + c;
+	}
+}
+
+Spaceobject *Entities::get_Target( int index ) const
+{
+	return ( owner[index] < 0 ) ? objects[index] : objects[ owner[index] ];
+}
+
+void Entities::get_Position( int i, int ahead, double &x, double &y ) const
+{
+	if ( ahead == 0 || ( period[i] == 0 && owner[i] < 0 ) ) {
+		x = pos_x[i];
+		y = pos_y[i];
+		return;
+	}
+
+	double owner_x = 0, owner_y = 0;
+
+	// Stones follow their Planet, even if it flies itself
+	if ( owner[i] >= 0 )
+		get_Position( owner[i], ahead, owner_x, owner_y );
+
+	if ( period[i] == 0 ) {
+		x = owner_x + pos_x[i] - pos_x[ owner[i] ];
+		y = owner_y + pos_y[i] - pos_y[ owner[i] ];
+		return;
+	}
+
+	int p = ( phase[i] + ahead ) % period[i];
+
+	x = owner_x + orbit_x[i][p];
+	y = owner_y + orbit_y[i][p];
+}
+
+bool Entities::touches( int i, double x, double y, double width, bool spacing, int ahead ) const
+{
+	double reach = width + this->width[i];
+
+	if ( spacing && kind[i] != ENTITY_STONE )
+		reach += this->spacing[i];
+
+	// Blackholes have a negative Width
+	if ( reach < 0 )
+		return false;
+
+	double dx, dy;
+
+	get_Position( i, ahead, dx, dy );
+	dx = x - dx;
+	dy = y - dy;
+
+	if ( 4 * ( dx*dx + dy*dy ) > reach * reach )
+		return false;
+
+	if ( spacing || mask[i] == NULL )
+		return true;
+
+	return mask[i]->overlap( dx, dy, ( width > 1 ) ? width/2 : 0.5 ) > 0;
+}
+
+int Entities::find_in_Family( int i, double x, double y, double width, bool spacing, int ahead ) const
+{
+	if ( touches( i, x, y, width, spacing, ahead ) )
+		return i;
+
+	if ( children[i] == 0 )
+		return -1;
+
+	// Far away from all Stones?
+	double dx = x - bound_x[i],
+		dy = y - bound_y[i],
+		reach = bound_radius[i] + ( ( width > 0 ) ? width/2 : 0 );
+
+	if ( dx*dx + dy*dy > reach*reach )
+		return -1;
+
+	for ( int j = i+1; j <= i+children[i]; j++ )
+		if ( touches( j, x, y, width, spacing, ahead ) )
+			return j;
+
+	return -1;
+}
+
+// Everything outside the Screen is in the Border-Cells
+int Entities::get_Column( double x ) const
+{
+	int column = (int)floor( x / GRIDCELLSIZE );
+
+	return ( column < 0 ) ? 0 : ( column >= columns ) ? columns-1 : column;
+}
+
+int Entities::get_Row( double y ) const
+{
+	int row = (int)floor( y / GRIDCELLSIZE );
+
+	return ( row < 0 ) ? 0 : ( row >= rows ) ? rows-1 : row;
+}
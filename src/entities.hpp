@@ -0,0 +1,176 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "entities.hpp"
+ *
+ * Entities - Position, Size and Weight of all Objects of a Galaxy in
+ * plain Arrays. The Galaxy fills them once per Frame (see
+ * Spaceobject::store()), so Collisions and Gravity are simple Loops
+ * without virtual Calls. The Spaceobjects stay for Drawing and for
+ * their Reaction on a Hit.
+ *
+ * A Grid over the Screen knows which Entities may be in which Cell,
+ * so a Collision-Query only tests the Entities near it. Entities
+ * with an Owner (Stones) are not in the Grid: they follow their
+ * Owner, whose Bounds enclose all its Stones, and are only tested
+ * if a Query is within these Bounds. So the Grid is only built
+ * again when Planets move.
+ *
+ * With many Entities (Asteroid-Fields) the Gravity is taken from a
+ * Quadtree that is built together with the Grid: a far away Group of
+ * Entities pulls like one Entity in its Center of Mass (Barnes-Hut).
+ *
+ * Planets on an Orbit are in the Grid with the Bounds of their whole
+ * Orbit and are looked up in their Ephemeris, so Queries for later
+ * Ticks see them where they will be.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __ENTITIES_HPP__
+#define __ENTITIES_HPP__
+
+#include <vector>
+
+#include "constants.hpp"
+
+class Spaceobject;
+class Mask;
+
+/******************************************************************************************
+ *
+ * Entities
+ *
+ ******************************************************************************************/
+class Entities
+{
+public:
+	enum Kind {
+		ENTITY_OTHER = 0,
+		ENTITY_PLANET = 1,
+		ENTITY_STONE = 2,
+		ENTITY_BLACKHOLE = 3,
+		ENTITY_WORMHOLE = 4,
+		ENTITY_ASTEROID = 5,
+		ENTITY_UFO = 6
+	};
+
+	Entities();
+
+	void clear();
+
+	// Returns the Index of the new Entity. A Hit of an Entity with an
+	// owner is a Hit of its Owner (Stones belong to their Planet).
+	// Entities of an Owner must be added right after it.
+	int add( Spaceobject *object, Kind kind, double x, double y, 
+		double width, double spacing, double weight, int owner = -1 );
+
+	// The Circle an Entity and all of its own Entities may reach until
+	// the Grid is built again. Without it the Entity (with Spacing) is
+	// its own Bounds.
+	void set_Bounds( int index, double x, double y, double radius );
+
+	// Entity index flies around its Owner on a fixed Orbit and is now at
+	// Offset x[phase], y[phase]. After period Ticks it is back at x[0], y[0].
+	// Without Owner x and y are the Positions on the Screen (Ephemeris).
+	void set_Orbit( int index, const float *x, const float *y, int period, int phase );
+
+	// Copies all Orbits into the Entities, so a Copy of them still works
+	// when the Galaxy they came from is gone. Masks are kept for ever
+	// anyway; the Targets of a Copy must not be used.
+	void keep_Orbits();
+
+	// Entity index is not round: After the Circle-Test its Mask decides.
+	// Queries with Spacing only use the Circle.
+	void set_Mask( int index, const Mask *mask );
+
+	// Sorts all Entities into the Grid (and the Quadtree) if their Bounds
+	// have changed. Call it after all Entities are added.
+	void index();
+
+	int size() const;
+
+	// Returns the Index of the first Entity that touches the Area or -1.
+	// Stones have no Spacing. Entities on an Orbit (and their own
+	// Entities) are taken where they will be in ahead Ticks.
+	int find_collision( double x, double y, double width, bool spacing = false, int ahead = 0 ) const;
+
+	// Puts the Indices of up to max Entities of that Kind that touch the
+	// Area into found and returns how many there are.
+	int find_Kind( Kind kind, double x, double y, double width, int *found, int max ) const;
+
+	// Adds the Pull of all Entities at x, y in ahead Ticks to gx, gy. A Node
+	// of the Quadtree is taken as a whole if its Size is less than
+	// theta times its Distance. Entities on an Orbit are never in the
+	// Tree.
+	void add_Gravity( double x, double y, double &gx, double &gy, int ahead = 0,
+		double theta = GRAVITYTHETA ) const;
+
+	// The Object that reacts on a Hit of Entity index
+	Spaceobject *get_Target( int index ) const;
+
+private:
+	std::vector<double> pos_x, pos_y;
+	std::vector<double> width, spacing, weight;
+	std::vector<int> kind, owner, children;
+	std::vector<Spaceobject *> objects;
+	std::vector<const float *> orbit_x, orbit_y;
+	std::vector<int> period, phase;
+	std::vector<const Mask *> mask;
+	std::vector<float> kept_orbits;		// See keep_Orbits()
+
+	// Grid: Entities of cell c are cell_entities[cell_start[c]..cell_start[c+1]-1]
+	std::vector<double> bound_x, bound_y, bound_radius;
+	std::vector<double> indexed_x, indexed_y, indexed_radius;
+	std::vector<int> cell_start, cell_entities;
+	int columns, rows;
+	bool indexed;
+
+	// Quadtree-Node: Square at x, y with edge size. Leafs have no
+	// Children and (mostly) one Entity.
+	struct Node {
+		double x, y, size;
+		double mass_x, mass_y, weight;	// Weighted Sums, then Center of Mass
+		int count;
+		int child;			// First of 4 Children or -1
+		int entity;
+	};
+
+	std::vector<Node> nodes;
+	std::vector<int> direct;		// Entities that are not in the Tree
+
+	void build_Tree();
+
+	void insert( int entity );
+
+	// Where Entity i will be in ahead Ticks
+	void get_Position( int i, int ahead, double &x, double &y ) const;
+
+	bool touches( int i, double x, double y, double width, bool spacing, int ahead ) const;
+
+	// First Hit of Entity i or one of its own Entities
+	int find_in_Family( int i, double x, double y, double width, bool spacing, int ahead ) const;
+
+	int get_Column( double x ) const;
+
+	int get_Row( double y ) const;
+};
+
+#endif
@@ -24,12 +24,24 @@
  ******************************************************************************************/
 
 #include <cmath>
+#include <sstream>
 
 #include "galaxy.hpp"
+#include "placement.hpp"
 #include "sound.hpp"
+#include "jobs.hpp"
 
 extern SDL_Surface* MYSDLSCREEN;
 extern Soundset *sound;
+extern Jobs *jobs;
+extern Tasks *tasks;
+extern Shotcache *shotcache;
+
+// All Pictures a Galaxy is made of
+static const int _GALAXYNAMES = 10;
+static const char *const GALAXYNAMES[_GALAXYNAMES] = {
+	"gfx/jupiter.gif", "gfx/earth.gif", "gfx/mars.gif", "gfx/venus.gif", "gfx/saturn.gif",
+	"gfx/moon.gif", "gfx/moon_mask.gif", "gfx/stone.gif", "gfx/stone_mask.gif", "gfx/hole.gif" };
 
 #ifdef __DEBUG__
 extern int __SHOOTS;
@@ -85,13 +97,14 @@ void Extra::init( Galaxy *galaxy )
 	}
 
 	if ( wait == 35 ) {
-		double x_test, y_test, width_test;
+		double x_test, y_test;
+		Random seed( Random::world.next() );
 	
-		do {	
-			x_test = RANDOM( SCREENWIDTH-150, 150 );
-			y_test = RANDOM( SCREENHEIGHT-50, 50 );
-			width_test = get_Width() + get_Spacing();
-		} while ( galaxy->check_collision( x_test, y_test, width_test, true ) );
+		// No Place? Try again later.
+		if ( !galaxy->find_Place( get_Width() + get_Spacing(), 150, 50, &seed, x_test, y_test ) ) {
+			wait = 100;
+			return;
+		}
 		
 		set_Pos( x_test, y_test );
 		
@@ -106,17 +119,22 @@ void Extra::draw()
 {
 	if ( wait<30 ) {
 		static double c_1 = 0, c_2 = 0;
+		static Uint32 last_tick = 0;
 		
 		if ( waiting < 30 )
-			extra_sprite->setAlpha( (int)RANDOM(15,0)+(waiting*6) );
+			extra_sprite->setAlpha( (int)RANDOM_FX(15,0)+(waiting*6) );
 		else
-			extra_sprite->setAlpha( 200+(int)RANDOM(15,0)-(wait*6) );
+			extra_sprite->setAlpha( 200+(int)RANDOM_FX(15,0)-(wait*6) );
+
+		if ( last_tick != Sprite::tick ) {
+			last_tick = Sprite::tick;
 			
-		if ( ( c_1 += 20*PI/180 ) > 2*PI )
+			if ( ( c_1 += 20*PI/180 ) > 2*PI )
 				c_1 -= 2*PI;
 	
-		if ( ( c_2 -= 30*PI/180 ) < 0 )
+			if ( ( c_2 -= 30*PI/180 ) < 0 )
 				c_2 += 2*PI;
+		}
 		
 		extra_sprite->setPos( (int)(x+sin(c_1)*2), (int)(y+sin(c_2)*2) );
 		extra_sprite->draw();
@@ -134,29 +152,36 @@ void Extra::hit( Spaceobject *object )
  * Stone								*
  *									*
  ************************************************************************/
-Stone::Stone( double x, double y, double angle )
+Stone::Stone( Arena *arena, Random *seed, double angle )
 :
-	Spaceobject ( x, y )
+	Spaceobject()
 {
 	verbose( "Initializing Stone" );
 
-	pos_1 = RANDOM(2*PI,0);
+	pos_1 = RANDOM_R(2*PI,0,seed);
 	distance = 0;
 
 	if ( angle == -1 ) {
 		is_moon = true;
-		pos_2 = RANDOM(2*PI,0);
-		stone_sprite = new Sprite( "gfx/moon.gif" );
-		stone_mask = new Sprite( "gfx/moon_mask.gif" );
-		speed = RANDOM(1,3);
+		pos_2 = RANDOM_R(2*PI,0,seed);
+		stone_sprite = arena->own( new ( *arena ) Sprite( "gfx/moon.gif" ) );
+		mask = Mask::get( "gfx/moon.gif" );
+		stone_mask = arena->own( new ( *arena ) Sprite( "gfx/moon_mask.gif" ) );
+		speed = RANDOM_R(1,3,seed);
 	} else {
 		is_moon = false;
 		pos_2 = angle;
-		stone_sprite = new Sprite("gfx/stone.gif");
-		stone_mask = new Sprite("gfx/stone_mask.gif");	
-		speed = RANDOM( 1,2 );
+		stone_sprite = arena->own( new ( *arena ) Sprite( "gfx/stone.gif" ) );
+		mask = Mask::get( "gfx/stone.gif" );
+		stone_mask = arena->own( new ( *arena ) Sprite( "gfx/stone_mask.gif" ) );
+		speed = RANDOM_R( 1,2, seed );
 	}
 
+	// Whole Ticks for one Orbit
+	period = (int)( 360/speed + 0.5 );
+	speed = 360.0/period;
+	phase = keep_phase = 0;
+
 	width = (double)stone_sprite->getWidth()-1;
 	x_a = x;
 	y_a = y;
@@ -165,14 +190,41 @@ Stone::Stone( double x, double y, double angle )
 Stone::~Stone() 
 {
 	verbose( "Deleting Stone" );
-
-	delete stone_sprite;
-	delete stone_mask;
 }
 
 void Stone::set_Distance( double distance )
 {
 	this->distance = distance;
+
+	for ( int i=0; i < period; i++ ) {
+		double p_1 = pos_1 + PI/180*speed*i,
+			p_2 = pos_2 + PI/180*speed*i;
+
+		orbit_x[i] = sin(p_1)*distance;
+		orbit_y[i] = ( is_moon ) ? sin(p_2)*distance : sin(-45*PI/180)*cos(p_1)/2*distance;
+		orbit_z[i] = sin(p_1+PI/180*90)/2+0.5;
+	}
+}
+
+void Stone::set_Tick( int tick )
+{
+	phase = tick % period;
+	x_a = orbit_x[phase]+x;
+	y_a = orbit_y[phase]+y;
+}
+
+void Stone::keep_Position()
+{
+	Spaceobject::keep_Position();
+	keep_phase = phase;
+}
+
+double Stone::get_Reach() const
+{
+	// Moons fly in a Square around the Planet, Rings in a flat Ellipse
+	double reach = ( is_moon ) ? distance*sqrt(2.0) : distance;
+
+	return reach + width/2;
 }
 
 bool Stone::check_collision( double x, double y, double width, bool spacing )
@@ -181,47 +233,39 @@ bool Stone::check_collision( double x, double y, double width, bool spacing )
 	double my_y = y_a;
 	double my_width = get_Width();
 
-	double dist_Center = sqrt( (x-my_x)*(x-my_x) + (y-my_y)*(y-my_y) );
+	double dist_Center2 = (x-my_x)*(x-my_x) + (y-my_y)*(y-my_y);
 	double dist_Radius = ( width+ my_width )/2;
 
-	return dist_Center <= dist_Radius;	
+	if ( dist_Radius < 0 || dist_Center2 > dist_Radius * dist_Radius )
+		return false;
+
+	return mask->overlap( x-my_x, y-my_y, ( width > 1 ) ? width/2 : 0.5 ) > 0;	
+}
+
+void Stone::store( Entities &entities, int owner )
+{
+	int me = entities.add( this, Entities::ENTITY_STONE, x_a, y_a, width, 0, 0, owner );
+
+	entities.set_Mask( me, mask );
+	entities.set_Orbit( me, orbit_x, orbit_y, period, phase );
 }
 
 void Stone::draw( bool behind_planet )
 {
-	double z = sin(pos_1+PI/180*90)/2+0.5;
+	double z = orbit_z[phase];
 
 	if ( ( behind_planet && z >= 0.5 ) ||
 		( !behind_planet && z < 0.5 ) ) {
 		
-		if ( is_moon ) {
-			x_a = sin(pos_1)*distance+x;
-			y_a = sin(pos_2)*distance+y;
-		} else {
-			x_a = sin(pos_1)*distance+x;
-			y_a = sin(-45*PI/180)*cos(pos_1)/2*distance+y;
-			//y_a = sin(pos_2)*cos(pos_1)/2*distance+y;
-		}
+		// Between the kept and the current Place on the Orbit
+		double draw_x = get_DrawX() + orbit_x[keep_phase] + ( orbit_x[phase]-orbit_x[keep_phase] ) * blend,
+			draw_y = get_DrawY() + orbit_y[keep_phase] + ( orbit_y[phase]-orbit_y[keep_phase] ) * blend;
 
-		stone_sprite->setPos( (int)x_a, (int)y_a );
+		stone_sprite->setPos( (int)draw_x, (int)draw_y );
 		stone_sprite->draw();
-		stone_mask->setPos( (int)x_a, (int)y_a );
+		stone_mask->setPos( (int)draw_x, (int)draw_y );
 		stone_mask->setAlpha( (int)(z*160) );
 		stone_mask->draw();
-	
-		if ( is_moon ) {
-			pos_1 += PI/180*speed;
-			pos_2 += PI/180*speed;
-		} else {
-			pos_1 += PI/180*speed;		
-			pos_2 += PI/180*1;
-		}
-		
-		if ( pos_1 >= 2*PI )
-			pos_1 -= 2*PI;
-	
-		if ( pos_2 >= 2*PI )
-			pos_2 -= 2*PI;
 	}
 	
 }
@@ -236,15 +280,20 @@ void Stone::hit( Spaceobject *object )
  * Planet								*
  *									*
  ************************************************************************/
-Planet::Planet( double x, double y ) 
+Planet::Planet( Arena *arena, Random *seed ) 
 :
-	Spaceobject ( x, y ),
-	hit_vector( Vector_2( 0, 0, K ) )
+	Spaceobject(),
+	hit_vector( Vector_2( 0, 0, K ) ),
+	ephemeris_x(NULL),
+	ephemeris_y(NULL),
+	period(0),
+	phase(0),
+	last_tick(0)
 {	
 	verbose( "Initializing Planet" );
 
 	char *planet_filename = "";
-	planet_type = (Planettype)RANDOM(5,0);
+	planet_type = (Planettype)RANDOM_R(5,0,seed);
 
 	switch ( planet_type ) {
 
@@ -252,21 +301,21 @@ Planet::Planet( double x, double y )
 			planet_filename = "gfx/jupiter.gif";
 			weight = WEIGHT_JUPITER;
 			spacing = 100;
-			objects_of_planet = (int)RANDOM(4,1);
+			objects_of_planet = (int)RANDOM_R(4,1,seed);
 			break;
 	
 		case P_EARTH:
 			planet_filename = "gfx/earth.gif";
 			weight = WEIGHT_EARTH;
 			spacing = 80;
-			objects_of_planet = (int)RANDOM(2,0);
+			objects_of_planet = (int)RANDOM_R(2,0,seed);
 			break;
 			
 		case P_MARS:
 			planet_filename = "gfx/mars.gif";
 			weight = WEIGHT_MARS;
 			spacing = 60;
-			objects_of_planet = (int)RANDOM(2,0);
+			objects_of_planet = (int)RANDOM_R(2,0,seed);
 			break;
 
 		case P_VENUS:
@@ -280,40 +329,49 @@ Planet::Planet( double x, double y )
 			planet_filename = "gfx/saturn.gif";
 			weight = WEIGHT_SATURN;
 			spacing = 70;
-			objects_of_planet = objects_of_planet=(int)RANDOM(MAXSTONES,20);
+			objects_of_planet = objects_of_planet=(int)RANDOM_R(MAXSTONES,20,seed);
 	}
 	
-	double angle_ring = RANDOM(2*PI,0), distance;
-	planet_sprite = new Sprite( planet_filename );
+	double angle_ring = RANDOM_R(2*PI,0,seed), distance;
+	planet_sprite = arena->own( new ( *arena ) Sprite( planet_filename ) );
+	mask = Mask::get( planet_filename );
 	width = (double)planet_sprite->getWidth()-2;	// Sub Anti-Alias Borders!
+	system_radius = width/2;
 	
 	for ( int i=0; i < objects_of_planet; i++ ) {
 		if ( objects_of_planet > 3 ) {
-			objects[i] = new Stone( 0,0,angle_ring );
-			distance = width/2+RANDOM(35,15);
+			objects[i] = arena->own( new ( *arena ) Stone( arena, seed, angle_ring ) );
+			distance = width/2+RANDOM_R(35,15,seed);
 		} else {		
-			objects[i] = new Stone();
-			distance = width/2+RANDOM(12,10);
+			objects[i] = arena->own( new ( *arena ) Stone( arena, seed ) );
+			distance = width/2+RANDOM_R(12,10,seed);
 		}
 		objects[i]->set_Distance( distance );
+
+		if ( objects[i]->get_Reach() > system_radius )
+			system_radius = objects[i]->get_Reach();
 	}
 }
 
 Planet::~Planet()
 {
 	verbose( "Deleting Planet" );
-
-	delete planet_sprite;
-	
-	for ( int i=0; i < objects_of_planet; i++ ) 
-		delete objects[i];	
 }
 
 bool Planet::check_collision( double x, double y, double width, bool spacing )
 {
-	if ( check_sphere_collision( x, y, width, spacing ) )
+	if ( check_sphere_collision( x, y, width, spacing ) &&
+		( spacing || mask->overlap( x-get_X(), y-get_Y(), ( width > 1 ) ? width/2 : 0.5 ) > 0 ) )
 		return true;
 
+	// Far away from all Stones?
+	double dx = x - get_X(),
+		dy = y - get_Y(),
+		reach = system_radius + width/2;
+
+	if ( dx*dx + dy*dy > reach*reach )
+		return false;
+
 	for ( int i=0; i < objects_of_planet; i++ )
 		if (objects[i]->check_collision( x, y, width ))
 			return true;
@@ -321,8 +379,64 @@ bool Planet::check_collision( double x, double y, double width, bool spacing )
 	return false;
 }
 
-void Planet::draw()
+void Planet::store( Entities &entities, int owner )
+{
+	int me = entities.add( this, Entities::ENTITY_PLANET, x, y, width, spacing, weight, owner );
+
+	entities.set_Mask( me, mask );
+
+	// Off its Orbit (falling into the Galaxy or pushed by a Hit) the
+	// Planet stands still for this Tick
+	if ( period > 0 && x == ephemeris_x[phase] && y == ephemeris_y[phase] ) {
+		entities.set_Orbit( me, ephemeris_x, ephemeris_y, period, phase );
+		entities.set_Bounds( me, orbit_x, orbit_y, orbit_reach );
+	} else if ( system_radius > ( width+spacing )/2 )
+		entities.set_Bounds( me, x, y, system_radius );
+
+	for ( int i=0; i < objects_of_planet; i++ )
+		objects[i]->store( entities, me );
+}
+
+void Planet::set_Orbit( Arena *arena, double center_x, double center_y, 
+	double radius_x, double radius_y, double angle, int period )
+{
+	this->period = period;
+	ephemeris_x = (float *)arena->allocate( period * sizeof(float) );
+	ephemeris_y = (float *)arena->allocate( period * sizeof(float) );
+
+	for ( int i=0; i < period; i++ ) {
+		double a = angle + 2*PI*i/period;
+
+		ephemeris_x[i] = center_x + cos(a)*radius_x;
+		ephemeris_y[i] = center_y - sin(a)*radius_y;
+	}
+
+	double reach = ( system_radius > ( width+spacing )/2 ) ? system_radius : ( width+spacing )/2;
+
+	orbit_x = center_x;
+	orbit_y = center_y;
+	orbit_reach = ( ( radius_x > radius_y ) ? radius_x : radius_y ) + reach;
+	phase = 0;
+	last_tick = 0;
+
+	set_Pos( ephemeris_x[0], ephemeris_y[0] );
+}
+
+double Planet::get_SystemRadius() const
+{
+	return system_radius;
+}
+
+void Planet::set_Tick( int tick )
 {
+	// Only a new Tick moves the Planet, so it can fall into its Place
+	// and be pushed by a Hit
+	if ( period > 0 && tick != last_tick ) {
+		phase = tick % period;
+		last_tick = tick;
+		set_Pos( ephemeris_x[phase], ephemeris_y[phase] );
+	}
+
 	if ( hit_vector.getLength() > 1 ) {
 		Vector_2 v = Vector_2( get_X(), get_Y(), K );
 		v += hit_vector;
@@ -332,10 +446,29 @@ void Planet::draw()
 
 	for ( int i=0; i < objects_of_planet; i++ ) {
 		objects[i]->set_Pos( x, y );
-		objects[i]->draw(true);
+		objects[i]->set_Tick( tick );
 	}
+}
+
+bool Planet::is_Pushed()
+{
+	return hit_vector.getLength() > 1;
+}
+
+void Planet::keep_Position()
+{
+	Spaceobject::keep_Position();
+
+	for ( int i=0; i < objects_of_planet; i++ )
+		objects[i]->keep_Position();
+}
 
-	planet_sprite->setPos( (int)x, (int)y );
+void Planet::draw()
+{
+	for ( int i=0; i < objects_of_planet; i++ )
+		objects[i]->draw(true);
+
+	planet_sprite->setPos( (int)get_DrawX(), (int)get_DrawY() );
 	planet_sprite->draw();
 
 	for ( int i=0; i < objects_of_planet; i++ ) 
@@ -351,35 +484,83 @@ void Planet::hit( Spaceobject *object )
 	object->hit( this );
 }
 
+/************************************************************************
+ *									*
+ * Asteroid								*	
+ *									*
+ ************************************************************************/
+Asteroid::Asteroid( Arena *arena, Random *seed ) 
+:
+	Spaceobject()
+{
+	verbose( "Initializing Asteroid" );
+
+	asteroid_sprite = arena->own( new ( *arena ) Sprite( "gfx/stone.gif" ) );
+	asteroid_mask = arena->own( new ( *arena ) Sprite( "gfx/stone_mask.gif" ) );
+	mask = Mask::get( "gfx/stone.gif" );
+	shadow = (int)RANDOM_R( 160, 40, seed );
+	width = (double)asteroid_sprite->getWidth()-1;
+	weight = WEIGHT_ASTEROID;
+	spacing = 8;
+}
+
+Asteroid::~Asteroid() 
+{
+	verbose( "Deleting Asteroid" );
+}
+
+bool Asteroid::check_collision( double x, double y, double width, bool spacing )
+{
+	return check_sphere_collision( x, y, width, spacing ) &&
+		( spacing || mask->overlap( x-get_X(), y-get_Y(), ( width > 1 ) ? width/2 : 0.5 ) > 0 );
+}
+
+void Asteroid::store( Entities &entities, int owner )
+{
+	int me = entities.add( this, Entities::ENTITY_ASTEROID, x, y, width, spacing, weight, owner );
+
+	entities.set_Mask( me, mask );
+}
+
+void Asteroid::draw() 
+{
+	asteroid_sprite->setPos( (int)get_DrawX(), (int)get_DrawY() );
+	asteroid_sprite->draw();
+	asteroid_mask->setPos( (int)get_DrawX(), (int)get_DrawY() );
+	asteroid_mask->setAlpha( shadow );
+	asteroid_mask->draw();
+}
+
+void Asteroid::hit( Spaceobject *object )
+{
+	object->hit( this );
+}
+
 /************************************************************************
  *									*
  * Blackhole								*	
  *									*
  ************************************************************************/
-Blackhole::Blackhole( double x, double y ) 
+Blackhole::Blackhole( Arena *arena, Random *seed ) 
 :
-	Spaceobject( x, y )
+	Spaceobject()
 {
 	verbose( "Initializing Blackhole" );
 
-	hole_sprite = new Sprite( "gfx/hole.gif" );
+	hole_sprite = arena->own( new ( *arena ) Sprite( "gfx/hole.gif" ) );
 	width = -1;
 	weight = WEIGHT_BLACKHOLE;
 	spacing = 150;
 	in_background = true;
+	last_tick = Sprite::tick;
 
 	for ( int i=0; i < MAXHOLE; i++ ) 
-		particles[i] = new Vector_2( RANDOM(65,5), RANDOM(2*PI,0), P );
+		particles[i] = Vector_2( RANDOM_R(65,5,seed), RANDOM_R(2*PI,0,seed), P );
 }
 
 Blackhole::~Blackhole() 
 {
 	verbose( "Deleting Blackhole" );
-
-	delete hole_sprite;
-
-	for ( int i=0; i < MAXHOLE; i++ ) 
-		delete particles[i];
 }
 
 bool Blackhole::check_collision( double x, double y, double width, bool spacing )
@@ -387,18 +568,29 @@ bool Blackhole::check_collision( double x, double y, double width, bool spacing
 	return check_sphere_collision( x, y, width, spacing );
 }
 
+void Blackhole::store( Entities &entities, int owner )
+{
+	entities.add( this, Entities::ENTITY_BLACKHOLE, x, y, width, spacing, weight, owner );
+}
+
 void Blackhole::draw() 
 {
 	static double hole_animPos = 0;
 
-	double x_anim = RANDOM(1,-1);
-	double y_anim = RANDOM(1,-1);
+	double x_anim = RANDOM_FX(1,-1);
+	double y_anim = RANDOM_FX(1,-1);
 	
 	hole_sprite->setAlpha(30);
-	hole_sprite->setPos( (int)(x+x_anim), (int)(y+y_anim) );
+	hole_sprite->setPos( (int)(get_DrawX()+x_anim), (int)(get_DrawY()+y_anim) );
 	hole_sprite->draw();
 
-	hole_animPos += ( 5*PI/180 );
+	// The Particles move once per Step of the Game
+	bool next = ( last_tick != Sprite::tick );
+
+	last_tick = Sprite::tick;
+
+	if ( next )
+		hole_animPos += ( 5*PI/180 );
 
 	if ( hole_animPos > 2*PI )
 		hole_animPos -= 2*PI;
@@ -407,25 +599,27 @@ void Blackhole::draw()
 
 	double t_speed = 1;
 
-	SDL_LockSurface(MYSDLSCREEN);
+	Sprite::lockScreen();
 	
 	// Draw Blackhole-Pixels
 	for ( int i=0; i < MAXHOLE; i++ ) {
-		double t_len = particles[i]->getLength();
-		double t_ang = particles[i]->getAngle();
+		double t_len = particles[i].getLength();
+		double t_ang = particles[i].getAngle();
 
-		if ( ( t_ang -= PI/180*3 ) < 0 ) 
-			t_ang += 2*PI;
+		if ( next ) {
+
+			if ( ( t_ang -= PI/180*3 ) < 0 ) 
+				t_ang += 2*PI;
 		
-		if ( ( t_len += t_speed/8+3 ) > 60 ) 
-			t_len -= 60+RANDOM(5,-5);
+			if ( ( t_len += t_speed/8+3 ) > 60 ) 
+				t_len -= 60+RANDOM_FX(5,-5);
 
-		delete particles[i];
-		particles[i] = new Vector_2( t_len, t_ang, P );
+			particles[i] = Vector_2( t_len, t_ang, P );
+		}
 
 		double f = cos( hole_animPos*PI/180 )/6+.75;
-		int xx = (int)( x+( particles[i]->getX())*f ) + Sprite::x_offset;
-		int yy = (int)( y+( particles[i]->getY())*f ) + Sprite::y_offset;
+		int xx = (int)( get_DrawX()+( particles[i].getX())*f ) + Sprite::x_offset;
+		int yy = (int)( get_DrawY()+( particles[i].getY())*f ) + Sprite::y_offset;
 
 		if ( t_speed++ > 3 ) 
 			t_speed -= 3;
@@ -449,7 +643,7 @@ void Blackhole::draw()
 		}
 	}
 	
-	SDL_UnlockSurface(MYSDLSCREEN);
+	Sprite::unlockScreen();
 }
 
 void Blackhole::hit( Spaceobject *object ) {}
@@ -459,9 +653,9 @@ void Blackhole::hit( Spaceobject *object ) {}
  * Wormhole								*	
  *									*
  ************************************************************************/
-Wormhole::Wormhole( double x, double y ) 
+Wormhole::Wormhole( Arena *arena, Random *seed ) 
 :
-	Spaceobject( x, y )
+	Spaceobject()
 {
 	verbose( "Initializing Wormhole" );
 
@@ -469,29 +663,27 @@ Wormhole::Wormhole( double x, double y )
 	weight = 50;
 	spacing = 60;
 	in_background = true;
-	exit_x = RANDOM(350, 150);
-	exit_y = RANDOM(350, 150);
+	last_tick = Sprite::tick;
+	exit_x = RANDOM_R(350, 150, seed);
+	exit_y = RANDOM_R(350, 150, seed);
 	
-	if ( (int)RANDOM(2,0) == 1 ) exit_x = -exit_x;
+	if ( (int)RANDOM_R(2,0,seed) == 1 ) exit_x = -exit_x;
 	
-	if ( (int)RANDOM(2,0) == 1 ) exit_y = -exit_y;
+	if ( (int)RANDOM_R(2,0,seed) == 1 ) exit_y = -exit_y;
 
 	for ( int i=0; i < MAXWORM; i++ ) 
-		particles[i] = (int)( RANDOM(800, 0) ) & 0x0000fff0;
+		particles[i] = (int)( RANDOM_R(800, 0, seed) ) & 0x0000fff0;
 
 	for ( int i=0; i < MAXWORM/15; i++ ) 
-		start_particles[i] = new Vector_2(
-			RANDOM( get_Width()*1.5, 5), 
-			RANDOM(2*PI,0),
+		start_particles[i] = Vector_2(
+			RANDOM_R( get_Width()*1.5, 5, seed ), 
+			RANDOM_R(2*PI,0,seed),
 			P );
 }
 
 Wormhole::~Wormhole()
 {
 	verbose( "Deleting Wormhole" );
-
-	for ( int i=0; i < MAXWORM/15; i++ ) 
-		delete start_particles[i];
 }
 
 bool Wormhole::check_collision( double x, double y, double width, bool spacing )
@@ -499,6 +691,11 @@ bool Wormhole::check_collision( double x, double y, double width, bool spacing )
 	return check_sphere_collision( x, y, width, spacing );
 }
 
+void Wormhole::store( Entities &entities, int owner )
+{
+	entities.add( this, Entities::ENTITY_WORMHOLE, x, y, width, spacing, weight, owner );
+}
+
 void Wormhole::draw() 
 {
 	Vector_2 path_to_exit = Vector_2( exit_x, exit_y, K );
@@ -506,19 +703,24 @@ void Wormhole::draw()
 
 	static int mooover = 0, mooover2 = 0;
 
-	if ( (mooover += 5) > 360 )
+	// The Particles move once per Step of the Game
+	bool next = ( last_tick != Sprite::tick );
+
+	last_tick = Sprite::tick;
+
+	if ( next && (mooover += 5) > 360 )
 		mooover -= 360;
 	
-	if ( (mooover2 -= 4) < 0 )
+	if ( next && (mooover2 -= 4) < 0 )
 		mooover += 360;
 
-	SDL_LockSurface(MYSDLSCREEN);
+	Sprite::lockScreen();
 	
 	for ( int i=0; i < MAXWORM; i++ ) {
 
 		double p = particles[i];
 
-		if ( ( p += i%3+1 ) > path_len )
+		if ( next && ( p += i%3+1 ) > path_len )
 			p -= path_len;
 		
 		particles[i] = p;
@@ -540,8 +742,8 @@ void Wormhole::draw()
 		double cf = (cos( (p/path_len)*2*PI )+1) /3+0.25;
 		double xx, yy, rr, gg, bb;
 
-		xx = ( get_X()+pos.getX() ) + Sprite::x_offset;
-		yy = ( get_Y()+pos.getY() ) + Sprite::y_offset;
+		xx = ( get_DrawX()+pos.getX() ) + Sprite::x_offset;
+		yy = ( get_DrawY()+pos.getY() ) + Sprite::y_offset;
 		
 		rr = ( 255-( (255*p/path_len)/4 ) )*cf;
 		bb = gg = ( 120+( (255*p/path_len)/4 ) )*cf;
@@ -550,38 +752,335 @@ void Wormhole::draw()
 	}
 
 	for ( int i=0; i < MAXWORM/15; i++  ) {
-		Vector_2 particle=Vector_2(
-			start_particles[i]->getLength()-RANDOM(3,1),
-			start_particles[i]->getAngle()+(5*PI/180),
-			P );
+		Vector_2 particle = start_particles[i];
+
+		if ( next )
+			particle = Vector_2(
+				particle.getLength()-RANDOM_FX(3,1),
+				particle.getAngle()+(5*PI/180),
+				P );
 
 		if ( particle.getLength() <= 2 ) {
 			particle=Vector_2(
-				RANDOM( get_Width()*1.5, get_Width()-10), 
-				RANDOM(2*PI,0),
+				RANDOM_FX( get_Width()*1.5, get_Width()-10), 
+				RANDOM_FX(2*PI,0),
 				P );
 		}
 
-		delete start_particles[i];
-		start_particles[i] = new Vector_2( particle.getLength(), particle.getAngle(), P );
+		start_particles[i] = particle;
 
 		int rr, gg, bb;
 		bb = (int)(50+(particle.getLength()*5));
 		gg = (int)((particle.getLength()*5));
 		rr = gg;
 
-		int xx = (int)( get_X()+particle.getX() ) + Sprite::x_offset;
-		int yy = (int)( get_Y()+particle.getY() ) + Sprite::y_offset;
+		int xx = (int)( get_DrawX()+particle.getX() ) + Sprite::x_offset;
+		int yy = (int)( get_DrawY()+particle.getY() ) + Sprite::y_offset;
 
 		Sprite::putpixel (xx, yy, SDL_MapRGB( MYSDLSCREEN->format, rr, gg, bb ) );
 	}
 	
-	SDL_UnlockSurface(MYSDLSCREEN);
+	Sprite::unlockScreen();
 }
 
 void Wormhole::hit( Spaceobject *object )
 {
 	object->set_Pos( get_X()+exit_x, get_Y()+exit_y );
+
+	// Jumps, doesn't fly
+	object->keep_Position();
+}
+
+/************************************************************************
+ *									*
+ * Shootsearch								*	
+ *									*
+ ************************************************************************/
+// One Shoot-configuration the Computer tries. Each Job chooses and
+// searches one of them with its own Shootpath and Random, the Galaxy
+// is only read.
+struct Candidate {
+	int player_id;
+	double factor;
+	double x, y, power, angle;
+	double top, bottom;
+	Galaxy *galaxy;
+	Shootpath *path;
+	Random *random;
+	bool coarse;
+	bool calculated;
+	bool hit;
+	double miss;		// How far the full Path misses or -1
+};
+
+static void search_Shoot( void *data )
+{
+	Candidate *candidate = (Candidate *)data;
+
+	candidate->y = (int)RANDOM_R( candidate->bottom, candidate->top, candidate->random );
+	candidate->power = (int)RANDOM_R( MAXSHOOTPOWER , 10, candidate->random );
+	candidate->angle = RANDOM_R( 2*PI, 0, candidate->random );
+
+	Vector_2 start = Vector_2( candidate->x, candidate->y, K ) + Vector_2( 60, candidate->angle, P );
+	Vector_2 direction = Vector_2( candidate->power*SHOOTPOWERFACTOR, candidate->angle, P );
+
+	// Most Shoots miss by far, the cheap Look sorts them out
+	candidate->calculated = !candidate->coarse || candidate->path->might_be_a_Hit( 
+		candidate->player_id, candidate->factor, start, direction, candidate->galaxy );
+
+	candidate->hit = false;
+	candidate->miss = -1;
+
+	if ( !candidate->calculated )
+		return;
+
+	Shootpath::Approach approaches[MAXPLAYER];
+	int amount = candidate->path->get_Approaches( candidate->player_id, 
+		start, direction, candidate->galaxy, approaches );
+
+	// A Miss that comes close is kept in case nothing hits
+	for ( int i=0; i < amount; i++ ) {
+		double miss = approaches[i].distance 
+			- Shootpath::get_Reach( approaches[i].ufo, candidate->factor );
+
+		if ( miss <= 0 )
+			candidate->hit = true;
+		else if ( candidate->miss < 0 || miss < candidate->miss )
+			candidate->miss = miss;
+	}
+}
+
+bool Shootsearch::coarse = true;
+
+Shootsearch::Shootsearch()
+:
+	player_id(0),
+	x(0),
+	top(0),
+	bottom(0),
+	factor(1),
+	galaxy(NULL),
+	generation(0),
+	found(false),
+	hit(false),
+	looked_up(false),
+	searches(MAXCOMPUTERSEARCH),
+	new_y(0),
+	new_power(0),
+	new_angle(0),
+	tried(0),
+	calculated(0),
+	closest(-1)
+{}
+
+void Shootsearch::start( int player_id, double x, double top, double bottom, int factor, Galaxy *galaxy )
+{
+	this->player_id = player_id;
+	this->x = x;
+
+	// Away from the Screenborders if the Slot lets it
+	this->top = ( top > 100 ) ? top : 100;
+	this->bottom = ( bottom < SCREENHEIGHT-200 ) ? bottom : SCREENHEIGHT-200;
+
+	if ( this->top > this->bottom ) {
+		this->top = top;
+		this->bottom = bottom;
+	}
+
+	this->factor = factor;
+	this->galaxy = galaxy;
+	generation = galaxy->get_Generation();
+}
+
+void Shootsearch::reset()
+{
+	found = false;
+	hit = false;
+	looked_up = false;
+	searches = MAXCOMPUTERSEARCH;
+	tried = 0;
+	calculated = 0;
+	closest = -1;
+}
+
+bool Shootsearch::is_Found() const
+{
+	return found;
+}
+
+bool Shootsearch::is_Hit() const
+{
+	return hit;
+}
+
+bool Shootsearch::is_Current() const
+{
+	return galaxy == NULL || generation == galaxy->get_Generation();
+}
+
+bool Shootsearch::confirm()
+{
+	static Shootpath path;
+
+	if ( !is_Current() ) {
+		reset();
+		return false;
+	}
+
+	// Still searching in the current Galaxy
+	if ( !found )
+		return true;
+
+	Vector_2 start = Vector_2( x, new_y, K ) + Vector_2( 60, new_angle, P );
+	Vector_2 direction = Vector_2( new_power*SHOOTPOWERFACTOR, new_angle, P );
+
+	if ( hit && path.will_be_a_Hit( player_id, factor, start, direction, galaxy ) )
+		return true;
+
+	reset();
+	return false;
+}
+
+double Shootsearch::get_Y() const
+{
+	return new_y;
+}
+
+double Shootsearch::get_Power() const
+{
+	return new_power;
+}
+
+double Shootsearch::get_Angle() const
+{
+	return new_angle;
+}
+
+bool Shootsearch::step()
+{
+	// All Searches share the Paths, only one of them steps at a time
+	static Shootpath paths[MAXWORKERS+1];
+	static Candidate candidates[MAXWORKERS+1];
+	static Random randoms[MAXWORKERS+1];
+	static bool seeded = false;
+
+	if ( found )
+		return true;
+
+	// A Shoot of an earlier Game in this Galaxy must hit again, the
+	// Stones may be somewhere else
+	if ( !looked_up ) {
+		looked_up = true;
+
+		if ( shotcache->find( galaxy->get_CacheKey( player_id ), new_y, new_power, new_angle )
+			&& new_y >= top && new_y <= bottom ) {
+			Vector_2 start = Vector_2( x, new_y, K ) + Vector_2( 60, new_angle, P );
+			Vector_2 direction = Vector_2( new_power*SHOOTPOWERFACTOR, new_angle, P );
+
+			if ( paths[0].will_be_a_Hit( player_id, factor, start, direction, galaxy ) ) {
+				found = hit = true;
+				return true;
+			}
+		}
+	}
+
+	// Each Job has its own Generator, split from the Stream of the
+	// Computer, so the Threads never share one
+	if ( !seeded ) {
+		for ( int i=0; i <= MAXWORKERS; i++ )
+			randoms[i] = Random::ai.split();
+
+		seeded = true;
+	}
+
+	// Randomize Shoot-configurations, one for each Thread
+	int amount = jobs->get_Workers()+1;
+
+	for ( int i=0; i < amount; i++ ) {
+		candidates[i].player_id = player_id;
+		candidates[i].factor = factor;
+		candidates[i].x = x;
+		candidates[i].top = top;
+		candidates[i].bottom = bottom;
+		candidates[i].galaxy = galaxy;
+		candidates[i].path = &paths[i];
+		candidates[i].random = &randoms[i];
+		candidates[i].coarse = coarse;
+		candidates[i].calculated = false;
+		candidates[i].hit = false;
+		candidates[i].miss = -1;
+
+		jobs->add( search_Shoot, &candidates[i] );
+	}
+
+	jobs->run();
+
+	for ( int i=0; i < amount; i++ )
+		if ( candidates[i].calculated )
+			calculated++;
+
+	tried += amount;
+
+	// The first Hit wins. Without one the nearest Miss is kept for the
+	// Time when the Computer has searched long enough.
+	int chosen = -1;
+
+	for ( int i=0; !found && i < amount; i++ )
+		if ( candidates[i].hit ) {
+			chosen = i;
+			found = true;
+			hit = true;
+		}
+
+	for ( int i=0; !found && i < amount; i++ )
+		if ( candidates[i].miss >= 0 && ( closest < 0 || candidates[i].miss < closest ) ) {
+			chosen = i;
+			closest = candidates[i].miss;
+		}
+
+	// Nothing came close yet, the Configuration is at least random
+	if ( chosen < 0 && closest < 0 )
+		chosen = amount-1;
+
+	if ( chosen >= 0 ) {
+		new_y = candidates[chosen].y;
+		new_power = candidates[chosen].power;
+		new_angle = candidates[chosen].angle;
+	}
+
+	if ( hit )
+		shotcache->store( galaxy->get_CacheKey( player_id ), new_y, new_power, new_angle );
+	
+	#ifdef __DEBUG__ 
+	//if (found) std::cout << "*** FEIND ENTDECKT BEI " <<  new_y << ", " << new_angle << std::endl;
+	#endif
+	
+	if ( (searches -= amount) < 0 )
+		found = true;
+
+	if ( found )
+		report();
+
+	return found;
+}
+
+void Shootsearch::set_Coarse( bool coarse )
+{
+	Shootsearch::coarse = coarse;
+}
+
+void Shootsearch::report()
+{
+	std::ostringstream info;
+	info << "Shootsearch tried " << tried << " Shoots, " << calculated 
+		<< " in full (" << tried-calculated << " saved)";
+
+	if ( !hit && closest >= 0 )
+		info << ", missed by " << (int)closest << " Pixels";
+	else if ( !hit )
+		info << ", no Hit";
+
+	verbose( info.str() );
 }
 
 /************************************************************************
@@ -592,12 +1091,15 @@ void Wormhole::hit( Spaceobject *object )
 Ufo::Ufo( double x, double y )
 :
 	Spaceobject(),
-	player_id(Ufo::current_playerid),
+	player_id(Ufo::current_playerid++),
+	team(player_id),
 	is_human(false),
 	is_active(false),
 	is_locked(false),
+	is_confirmed(false),
 	shield_strength(MAXENERGY),
 	bonus(0),
+	rechecks(0),
 	bought_weapon(WEAPON_LASER)
 {
 	verbose( "Initializing Ufo" );
@@ -606,28 +1108,27 @@ Ufo::Ufo( double x, double y )
 	
 	char *u_filename = "", *c_filename = "";
 	double angle=0;
-	
-	switch (Ufo::current_playerid++) {
-	
-		case 0:
-			x = BORDERWIDTH;
-			angle = 0;
-			u_filename = "gfx/ufored.gif";
-			c_filename = "gfx/cpktred.gif";
-			break;	
-		case 1:
-			x = SCREENWIDTH-BORDERWIDTH;
-			angle = PI;
-			u_filename = "gfx/ufoblue.gif";
-			c_filename = "gfx/cpktblue.gif";
-			break;
+
+	// Saucers on the left Side are red and look right
+	if ( x < SCREENWIDTH/2 ) {
+		angle = 0;
+		u_filename = "gfx/ufored.gif";
+		c_filename = "gfx/cpktred.gif";
+	} else {
+		angle = PI;
+		u_filename = "gfx/ufoblue.gif";
+		c_filename = "gfx/cpktblue.gif";
 	}
 
 	set_Pos( x, y );
+	keep_Position();
 	width = 48;
 	
 	shoot_angle = angle;
 	shoot_power = 0;
+
+	slot_top = BORDERWIDTH;
+	slot_bottom = SCREENHEIGHT-BORDERWIDTH;
 	
 	ufo_sprite = new Sprite( u_filename, 25 );
 	circle_sprite = new Sprite( c_filename );
@@ -645,6 +1146,8 @@ Ufo::~Ufo()
 {
 	verbose( "Deleting Ufo" );
 
+	tasks->remove( &search );
+
 	delete ufo_sprite;
 	delete circle_sprite;
 	delete thinking_sprite;
@@ -683,6 +1186,10 @@ void Ufo::reset()
 	bought_weapon = WEAPON_LASER;
 	is_active = false;
 	is_locked = false;
+
+	// A new Game searches again
+	tasks->remove( &search );
+	search.reset();
 }
 
 void Ufo::set_Human()
@@ -766,6 +1273,8 @@ void Ufo::activate()
 {	
 	is_active = true;
 	is_locked = false;
+	is_confirmed = false;
+	rechecks = MAXCOMPUTERRECHECKS;
 	shoot_power = 0;
 }
 	
@@ -774,15 +1283,21 @@ void Ufo::deactivate()
 	is_active = false;
 }
 
+void Ufo::set_Slot( double top, double bottom )
+{
+	slot_top = top;
+	slot_bottom = bottom;
+}
+
 void Ufo::move_Up()
 {
-	if ( y > BORDERWIDTH ) 
+	if ( y > slot_top ) 
 		y -= 2;
 }
 
 void Ufo::move_Down()
 {
-	if ( is_active && y < SCREENHEIGHT-BORDERWIDTH ) 
+	if ( is_active && y < slot_bottom ) 
 		y += 2;
 }
 
@@ -804,7 +1319,7 @@ void Ufo::inc_ShootPower()
 		shoot_power = MAXSHOOTPOWER;
 }
 
-Shoot *Ufo::shoot()
+bool Ufo::shoot( Galaxy *galaxy )
 {
 	if ( is_active ) {
 
@@ -812,89 +1327,61 @@ Shoot *Ufo::shoot()
 
 		Vector_2 v_start = Vector_2( get_X(), get_Y(), K )+Vector_2( 60, shoot_angle, P );
 		Vector_2 v_direction = Vector_2( shoot_power*SHOOTPOWERFACTOR, shoot_angle, P );
-
-		static Heavy heavy_shoot = Heavy(); 
-		static Cluster cluster_shoot = Cluster();
-		static Cluster funghi_shoot = Cluster();
-		static Laser laser_shoot = Laser();
+		int weapon = bought_weapon;
 
 		#ifdef __DEBUG__ 
 		__SHOOTS++;
 		//std::cout << __HITS << "/" << __SHOOTS << "=" << (int)(__HITS*100/__SHOOTS) << "%" << std::endl;
 		#endif
 
-		switch ( bought_weapon ) {
-		
-			case WEAPON_HEAVY:	
-				bought_weapon = WEAPON_LASER;
-				heavy_shoot.activate( v_start, v_direction );
-				return &heavy_shoot;
-	
-			case WEAPON_CLUSTER:
-				bought_weapon = WEAPON_LASER;
-				cluster_shoot.activate( v_start, v_direction );
-				return &cluster_shoot;
-			
-			case WEAPON_FUNGHI:
-				bought_weapon = WEAPON_LASER;
-				funghi_shoot.activate( v_start, v_direction );
-				return &funghi_shoot;
-				
-			default:
-				laser_shoot.activate( v_start, v_direction );
-				return &laser_shoot;
-		}
+		// Bought Weapons are used once
+		bought_weapon = WEAPON_LASER;
+
+		return galaxy->launch( weapon, v_start, v_direction );
 	}
 	
-	return NULL;
+	return false;
 }
 
 bool Ufo::calculate_Computer_Move( Galaxy *galaxy, int factor ) 
 {
-	static Shoot s = Shoot();
-	static bool found = false;
-	static int searches = MAXCOMPUTERSEARCH;
-	static double new_ShootPower, new_ShootAngle, new_y;
 	bool canshoot = false;
 	computer_mode = NONE;
+
+	// What was pondered during the other Turns must still hit
+	if ( !is_confirmed ) {
+		is_confirmed = true;
+
+		if ( !search.confirm() )
+			tasks->remove( &search );
+	}
 	
-	// Zug suchen
-	if ( !found && !is_locked ) {
+	// Zug suchen, Tasks::run() sucht weiter
+	if ( !search.is_Found() && !is_locked ) {
 		
 		if (bonus == 1 && shield_strength < 40)
 			buy_Bonus();
 
-		if ( bonus == 2 && (RANDOM(10,0) < 2) )
+		if ( bonus == 2 && (RANDOM_AI(10,0) < 2) )
 			buy_Bonus();
 		
-		if ( bonus == 3 && (RANDOM(10,0) < 8) )
+		if ( bonus == 3 && (RANDOM_AI(10,0) < 8) )
 			buy_Bonus();
-		
-		canshoot = false;
-
-		// Randomize Shoot-configuration
-		new_y = (int)RANDOM( SCREENHEIGHT-200, 100 );
-		new_ShootPower = (int)RANDOM( MAXSHOOTPOWER , 10 );
-		new_ShootAngle = RANDOM( 2*PI, 0 );
-		
-		Vector_2 start = Vector_2( get_X(), new_y, K ) + Vector_2( 60, new_ShootAngle, P );
-		Vector_2 direction = Vector_2( new_ShootPower*SHOOTPOWERFACTOR, new_ShootAngle, P);
 
-		found = s.will_be_a_Hit( player_id, factor, start, direction, galaxy );
-		
-		#ifdef __DEBUG__ 
-		//if (found) std::cout << "*** FEIND ENTDECKT BEI " <<  start << ", " << direction << std::endl;
-		#endif
-		
-		if ( --searches < 0 )
-			found = true;
+		if ( !tasks->has( &search ) ) {
+			search.start( player_id, get_X(), slot_top, slot_bottom, factor, galaxy );
+			tasks->add( &search );
+		}
 		
-		if ( !found )
-			computer_mode = THINKING;
+		computer_mode = THINKING;
 	}
 
+	double new_y = search.get_Y(),
+		new_ShootPower = search.get_Power(),
+		new_ShootAngle = search.get_Angle();
+
 	// Schuss und Position einstellen
-	if ( found && !canshoot ) {
+	if ( search.is_Found() && !canshoot ) {
 		canshoot = true;
 
 		if ( (int)new_y < y ) {
@@ -938,14 +1425,22 @@ bool Ufo::calculate_Computer_Move( Galaxy *galaxy, int factor )
 			computer_mode = SHOOTING;
 	}
 
+	// Aiming took its Time and the Stones have moved on meanwhile, so
+	// the Hit is tested again. If it misses, the Computer searches again.
+	if ( canshoot && search.is_Hit() && rechecks > 0 && !search.confirm() ) {
+		rechecks--;
+		tasks->remove( &search );
+
+		return false;
+	}
+
 	// Schuss
 	if ( canshoot ) {
 		computer_mode = NONE;
-		searches = MAXCOMPUTERSEARCH;
 		shoot_power = new_ShootPower;
 		canshoot = false;
-		galaxy->set_Shoot( shoot() );
-		found = false;
+		shoot( galaxy );
+		search.reset();
 		is_locked = true;
 		
 		return true;
@@ -955,6 +1450,24 @@ bool Ufo::calculate_Computer_Move( Galaxy *galaxy, int factor )
 
 }
 
+void Ufo::ponder( Galaxy *galaxy, int factor )
+{
+	// A pushed Planet or a new Galaxy spoils the Search
+	if ( !search.is_Current() ) {
+		tasks->remove( &search );
+		search.reset();
+	}
+
+	// Without a Hit it goes on searching until the Turn begins
+	if ( search.is_Found() && !search.is_Hit() )
+		search.reset();
+
+	if ( !search.is_Found() && !tasks->has( &search ) ) {
+		search.start( player_id, get_X(), slot_top, slot_bottom, factor, galaxy );
+		tasks->add( &search );
+	}
+}
+
 bool Ufo::check_collision( double x, double y, double width, bool spacing )
 {
 	return check_sphere_collision( x, y, width, spacing );
@@ -962,7 +1475,7 @@ bool Ufo::check_collision( double x, double y, double width, bool spacing )
 
 void Ufo::draw() 
 {
-	ufo_sprite->setPos( (int)(this->get_X()-2), (int)(get_Y()+10) );
+	ufo_sprite->setPos( (int)(get_DrawX()-2), (int)(get_DrawY()+10) );
 	ufo_sprite->draw();
 	
 	draw_Targetmode();
@@ -984,21 +1497,36 @@ void Ufo::hit( Spaceobject *object )
 	object->hit( this );
 }
 
-void Ufo::draw_hint( Galaxy *galaxy )
+void Ufo::set_Team( int team )
+{
+	this->team = team;
+}
+
+int Ufo::get_Team() const
+{
+	return team;
+}
+
+void Ufo::store( Entities &entities, int owner )
+{
+	// Shoots fly through the Wreck
+	if ( !is_dead() )
+		entities.add( this, Entities::ENTITY_UFO, x, y, width, spacing, weight, owner );
+}
+
+void Ufo::draw_hint( Hintpreview *preview )
 {
 	Vector_2 start = Vector_2( get_X(), get_Y(), K ) + Vector_2( 60, shoot_angle, P );
-	Vector_2 direction = Vector_2( 100 * SHOOTPOWERFACTOR, shoot_angle, P );
-	
-	static Laser *ufo_shoot = new Laser();
 
-	ufo_shoot->draw_hint( start, direction, galaxy ); 
+	preview->request( start, shoot_angle );
+	preview->draw();
 }
 
 void Ufo::draw_Targetmode()
 {	
 	if ( is_active ) {
 
-		Vector_2 m = Vector_2(x, y, K);
+		Vector_2 m = Vector_2( get_DrawX(), get_DrawY(), K );
 		double distance = 30;
 		int alpha = 150;
 		
@@ -1026,12 +1554,12 @@ void Ufo::draw_Computermode()
 		switch (computer_mode) {
 		
 			case THINKING: 
-				thinking_sprite->setPos( (int)get_X(), (int)get_Y() );
+				thinking_sprite->setPos( (int)get_DrawX(), (int)get_DrawY() );
 				thinking_sprite->draw();
 				break;
 			
 			case SHOOTING:
-				shooting_sprite->setPos( (int)get_X(), (int)get_Y() );
+				shooting_sprite->setPos( (int)get_DrawX(), (int)get_DrawY() );
 				shooting_sprite->draw();
 				break;
 			default:
@@ -1051,38 +1579,72 @@ Galaxy::Galaxy( int max, int id )
 :
 	is_imploding(false),
 	objects_in_galaxy(0),
-	ufos_in_galaxy(0)
+	ufos_in_galaxy(0),
+	type(GALAXY_PLANETS),
+	tick(0),
+	generation(0),
+	seed(0),
+	planets(0),
+	creator(NULL)
 {
 	verbose( "Initializing Galaxy" );
 
+	// The Creator-Thread must find all Pictures in Displayformat
+	// and their Masks
+	for ( int i=0; i < _GALAXYNAMES; i++ )
+		Mask::get( GALAXYNAMES[i] );
+
+	next.ready = retired.ready = false;
+	next.type = retired.type = GALAXY_PLANETS;
+	next.objects_in_galaxy = retired.objects_in_galaxy = 0;
+
+	entities_lock = SDL_CreateMutex();
+
+	// One Arena for the shown Galaxy, one for the next and one
+	// for the old Galaxy
+	arena = new Arena();
+	next.arena = new Arena();
+	retired.arena = new Arena();
+
 	extra = new Extra();
+	projectiles = new Projectiles();
 	create( max, id );
-	shoot = NULL;
 }
 	
 Galaxy::~Galaxy()
 {
 	verbose( "Deleting Galaxy" );
 
-	for ( int i=0; i < objects_in_galaxy; i++ ) 
-		delete objects[i];
+	wait_for_Creator();
+	destroy( next );
+	destroy( retired );
 	
+	delete arena;
+	delete next.arena;
+	delete retired.arena;
 	delete extra;
+	delete projectiles;
+
+	SDL_DestroyMutex( entities_lock );
 }
 
 double Galaxy::get_ShootX() const
 {
-	return ( shoot == NULL ) ? 0 : shoot->get_X();
+	const Projectile *leader = projectiles->get_Leader();
+
+	return ( leader == NULL ) ? 0 : leader->get_X();
 }
 	
 double Galaxy::get_ShootY() const
 {
-	return ( shoot == NULL ) ? 0 : shoot->get_Y();
+	const Projectile *leader = projectiles->get_Leader();
+
+	return ( leader == NULL ) ? 0 : leader->get_Y();
 }
 
 bool Galaxy::is_ShootActive() const
 {
-	return ( shoot == NULL ) ? false : shoot->is_active();
+	return projectiles->is_active();
 }
 	
 bool Galaxy::is_Imploding() const
@@ -1092,70 +1654,122 @@ bool Galaxy::is_Imploding() const
 
 bool Galaxy::is_Ufo_In_Area( int player_id, double x, double y, double factor )
 {
-	for ( int i=0; i < MAXPLAYER; i++ ) {
+	int found[MAXPLAYER];
+	int amount = entities.find_Kind( Entities::ENTITY_UFO, x, y, 8 * factor, found, MAXPLAYER );
 
-		if ( i != player_id ) {
-			if ( ufos[i]->check_collision( x, y, 8 * factor ) )
-				return true;
-		}
-	}
+	for ( int i=0; i < amount; i++ )
+		if ( ( (Ufo *)entities.get_Target( found[i] ) )->get_Team() != ufos[player_id]->get_Team() )
+			return true;
 	
 	return false;
 }
 
+int Galaxy::find_Enemies( int player_id, Ufo **enemies ) const
+{
+	int amount = 0;
+
+	for ( int i=0; i < ufos_in_galaxy; i++ )
+		if ( ufos[i]->get_Team() != ufos[player_id]->get_Team() && !ufos[i]->is_dead() )
+			enemies[amount++] = ufos[i];
+
+	return amount;
+}
+
 void Galaxy::set_Ufos( Ufo **ufos, int max ) 
 {
 	this->ufos = ufos;
 	ufos_in_galaxy = max;	
 }
 
-void Galaxy::set_Shoot( Shoot *shoot )
+bool Galaxy::launch( int weapon, Vector_2 start, Vector_2 vector )
 {
-	if ( shoot != NULL ) {
-		this->shoot = shoot;
-	}
+	return projectiles->launch( weapon, start, vector );
+}
+
+double Galaxy::get_ShootWidth( int weapon ) const
+{
+	return projectiles->get_Width( weapon );
 }
 
 void Galaxy::kill_all_Shoots() 
 {
-	if ( shoot != NULL ) {
-		shoot->destroy();
-		shoot->reset();
-	}
+	projectiles->destroy();
 }
 
 bool Galaxy::has_Extra_collision()
 {
-	if ( shoot != NULL )
-		return shoot->has_Extra_collision( extra );
-		
-	return false;
+	return projectiles->has_Extra_collision( extra );
 }
 bool Galaxy::has_collision( Spaceobject *object )
 {
-	// Check all Objects
-	for ( int i=0; i < objects_in_galaxy; i++ )
-		if ( objects[i]->has_collision(object) ) 
-			return true;
+	// Check all Objects and Flying Saucers
+	int i = entities.find_collision( object->get_X(), object->get_Y(), object->get_Width() );
 
-	// Check all Flying Saucers
-	for ( int i=0; i < ufos_in_galaxy; i++ )
-		if ( ufos[i]->has_collision(object) )
-			return true;
+	if ( i >= 0 ) {
+		entities.get_Target( i )->hit( object );
+		return true;
+	}
 
 	return false;
 }
 	
-bool Galaxy::check_collision( double x, double y, double width, bool spacing )
+bool Galaxy::check_collision( double x, double y, double width, bool spacing, int ahead )
 {
-	for ( int i=0; i < objects_in_galaxy; i++ ) 
-		if ( objects[i]->check_collision( x, y, width, spacing ) ) 
-			return true;
+	return entities.find_collision( x, y, width, spacing, ahead ) >= 0;
+}
 
-	return false;
+int Galaxy::get_Tick() const
+{
+	return tick;
+}
+
+void Galaxy::copy_Entities( Entities &copy )
+{
+	// The Copy gets its own Orbits, the Arena may get a new Galaxy
+	// while the Copy is still used
+	SDL_LockMutex( entities_lock );
+	copy = entities;
+	copy.keep_Orbits();
+	SDL_UnlockMutex( entities_lock );
+}
+
+int Galaxy::get_Generation() const
+{
+	return generation;
 }
 
-bool Galaxy::create( int max, int id )
+Shotcache::Key Galaxy::get_CacheKey( int player_id ) const
+{
+	Shotcache::Key key;
+
+	key.seed = seed;
+	key.type = type;
+	key.planets = planets;
+	key.shooter_x = (int)ufos[player_id]->get_X();
+	key.shooter_band = (int)ufos[player_id]->get_Y() / SHOTCACHEBAND;
+	key.targets = 0;
+
+	for ( int i=0; i < ufos_in_galaxy; i++ )
+		if ( ufos[i]->get_Team() != ufos[player_id]->get_Team() && !ufos[i]->is_dead() )
+			key.targets = key.targets * 31 + (Uint32)ufos[i]->get_X() * 64 
+				+ (Uint32)ufos[i]->get_Y() / SHOTCACHEBAND;
+
+	return key;
+}
+
+bool Galaxy::find_Place( double width, double border_x, double border_y, 
+	Random *seed, double &x, double &y )
+{
+	Placement placement( border_x, border_y, SCREENWIDTH-border_x, SCREENHEIGHT-border_y, 200 );
+
+	for ( int i=0; i < objects_in_galaxy; i++ )
+		placement.add( objects[i]->get_X(), objects[i]->get_Y(), 
+			( objects[i]->get_Width() + objects[i]->get_Spacing() ) / 2 );
+
+	return placement.place( width/2, seed, x, y );
+}
+
+bool Galaxy::create( int max, int id, Galaxytype type )
 {
 	if ( !is_imploding ) {
 		
@@ -1163,47 +1777,60 @@ bool Galaxy::create( int max, int id )
 
 		extra->kill();
 		
-		srand(id);
-		
+		max = ( max < MAXGALAXYOBJECTS ) ? max : MAXGALAXYOBJECTS;
+
+		wait_for_Creator();
+
+		// Nothing (or the wrong Galaxy) prepared? Create it now...
+		if ( !next.ready || next.max != max || next.seed != id || next.type != type ) {
+			destroy( next );
+			next.max = max;
+			next.seed = id;
+			next.type = type;
+			generate( next );
+		}
+
+		// ...and exchange it. The old Planets are deleted by the next
+		// Creator-Thread.
+		destroy( retired );
+
+		Arena *empty = retired.arena;
+
 		for ( int i=0; i < objects_in_galaxy; i++ )
-			delete objects[i];
+			retired.objects[i] = objects[i];
 
-		objects_in_galaxy = 0;
-		max = ( max < MAXPLANETS ) ? max : MAXPLANETS;
+		retired.objects_in_galaxy = objects_in_galaxy;
+		retired.arena = arena;
+		objects_in_galaxy = next.objects_in_galaxy;
+		arena = next.arena;
 		
-		for ( int i=0; i < max; i++ ) {
-			double x_test, y_test, width_test;
-			Spaceobject *tmp_planet = NULL;
-			int type_of_planet = (int)RANDOM(8,0);
+		for ( int i=0; i < objects_in_galaxy; i++ ) {
+			objects[i] = next.objects[i];
+			animate_position[i].y = next.final_y[i];
+		}
 
-			//std::cout << "PLANETTYPE=" << type_of_planet << std::endl;
+		next.objects_in_galaxy = 0;
+		next.ready = false;
+		next.arena = empty;
 
-			switch ( type_of_planet ) {
-				
-				case 5: 
-					tmp_planet = new Blackhole();
-					break;
-				case 6: 
-					tmp_planet = new Wormhole();
-					break;
-				default:
-					tmp_planet = new Planet();
-			}
-			
-			do {	
-				x_test = RANDOM( SCREENWIDTH-220, 220 );
-				y_test = RANDOM( SCREENHEIGHT, 0 );
-				width_test = tmp_planet->get_Width() + tmp_planet->get_Spacing();
-			} while ( check_collision( x_test, y_test, width_test, true ) );
-
-			tmp_planet->set_Pos( x_test, y_test );
-			animate_position[i].y = y_test;
-			objects[objects_in_galaxy++] = tmp_planet;
-		}
+		// Orbits start at Tick 0
+		this->type = type;
+		tick = 0;
+		generation++;
+		seed = id;
+		planets = max;
+
+		std::ostringstream info;
+		info << "Galaxy uses " << arena->get_Used() << " Bytes (max. " 
+			<< arena->get_HighWater() << " Bytes)";
+		verbose( info.str() );
 
 		for ( int i=0; i < objects_in_galaxy; i++ )
 			objects[i]->set_Pos( objects[i]->get_X(), -600 );
 
+		refresh_Entities();
+		keep_Positions();
+
 		is_imploding = true;
 		
 		sound->play(SOUND_WARPGALAXY);
@@ -1213,39 +1840,199 @@ bool Galaxy::create( int max, int id )
 	
 	return false;
 }
-	
-void Galaxy::calculate_nextPos( Vector_2 &position, Vector_2 &direction )
+
+void Galaxy::prepare( int max, int id, Galaxytype type )
 {
-	Vector_2 vec_toPlanets = Vector_2( 0, 0, K );
+	wait_for_Creator();
+	destroy( next );
 
-	for ( int i=0; i < objects_in_galaxy; i++ ) {
-		Vector_2 vec_PlanetPos = Vector_2( objects[i]->get_X(), objects[i]->get_Y(), K);
-		double distance = vec_PlanetPos.distance(position);
-		Vector_2 vec_toPlanet = vec_PlanetPos-position;
-		vec_toPlanet = vec_toPlanet.newLength( objects[i]->get_Weight()/distance );
-		vec_toPlanets = vec_toPlanets+vec_toPlanet;
+	next.max = ( max < MAXGALAXYOBJECTS ) ? max : MAXGALAXYOBJECTS;
+	next.seed = id;
+	next.type = type;
+
+	// Without Thread the Galaxy is created in create()
+	creator = SDL_CreateThread( Galaxy::creator_Thread, this );
+}
+
+void Galaxy::wait_for_Creator()
+{
+	if ( creator != NULL ) {
+		SDL_WaitThread( creator, NULL );
+		creator = NULL;
+	}
+}
+
+int Galaxy::creator_Thread( void *data )
+{
+	Galaxy *galaxy = (Galaxy *)data;
+
+	destroy( galaxy->retired );
+	generate( galaxy->next );
+
+	return 0;
+}
+
+void Galaxy::generate( Creation &creation )
+{
+	Random seed( creation.seed );
+	bool asteroids = creation.type == GALAXY_ASTEROIDS;
+	Placement placement( 220, 0, SCREENWIDTH-220, SCREENHEIGHT, ( asteroids ) ? 32 : 200 );
+
+	creation.objects_in_galaxy = 0;
+
+	if ( creation.type == GALAXY_ORBITS ) {
+		generate_Orbits( creation, &seed );
+		creation.ready = true;
+		return;
 	}
-	direction += vec_toPlanets;
+
+	for ( int i=0; i < creation.max; i++ ) {
+		double x_test, y_test;
+		Spaceobject *tmp_planet = NULL;
+		int type_of_planet = ( asteroids ) ? -1 : (int)RANDOM_R(8,0,&seed);
+
+		switch ( type_of_planet ) {
+			
+			case -1:
+				tmp_planet = creation.arena->own( new ( *creation.arena ) Asteroid( creation.arena, &seed ) );
+				break;
+			
+			case 5: 
+				tmp_planet = creation.arena->own( new ( *creation.arena ) Blackhole( creation.arena, &seed ) );
+				break;
+			case 6: 
+				tmp_planet = creation.arena->own( new ( *creation.arena ) Wormhole( creation.arena, &seed ) );
+				break;
+			default:
+				tmp_planet = creation.arena->own( new ( *creation.arena ) Planet( creation.arena, &seed ) );
+		}
+
+		double radius = ( tmp_planet->get_Width() + tmp_planet->get_Spacing() ) / 2;
+
+		// Stays in the Arena until the next reset()
+		if ( !placement.place( radius, &seed, x_test, y_test ) ) 
+			continue;
+
+		tmp_planet->set_Pos( x_test, y_test );
+		creation.final_y[creation.objects_in_galaxy] = y_test;
+		creation.objects[creation.objects_in_galaxy++] = tmp_planet;
+	}
+
+	creation.ready = true;
+}
+
+// Outer Planets are slower (Kepler: the Period grows with Radius^1.5)
+static int orbit_Period( double radius )
+{
+	int period = (int)( ORBITPERIOD * pow( radius/100, 1.5 ) );
+
+	return ( period < 1 ) ? 1 : ( period > MAXEPHEMERIS ) ? MAXEPHEMERIS : period;
+}
+
+void Galaxy::generate_Orbits( Creation &creation, Random *seed )
+{
+	Arena *arena = creation.arena;
+	double center_x = SCREENWIDTH/2,
+		center_y = SCREENHEIGHT/2,
+		room_x = SCREENWIDTH/2-220,		// The Ufos stay outside
+		room_y = SCREENHEIGHT/2;
+	Planet *sun = arena->own( new ( *arena ) Planet( arena, seed ) );
+	double reach = sun->get_SystemRadius();
+
+	sun->set_Pos( center_x, center_y );
+	creation.objects[creation.objects_in_galaxy++] = sun;
+
+	// Sometimes two Suns fly around their common Center of Mass
+	if ( creation.max > 1 && RANDOM_R(2,0,seed) >= 1 ) {
+		Planet *twin = arena->own( new ( *arena ) Planet( arena, seed ) );
+		double distance = sun->get_SystemRadius() + twin->get_SystemRadius() + ORBITGAP,
+			weights = sun->get_Weight() + twin->get_Weight(),
+			radius_sun = distance * twin->get_Weight() / weights,
+			radius_twin = distance * sun->get_Weight() / weights,
+			angle = RANDOM_R(2*PI,0,seed);
+		int period = orbit_Period( distance );
+
+		sun->set_Orbit( arena, center_x, center_y, radius_sun, radius_sun, angle, period );
+		twin->set_Orbit( arena, center_x, center_y, radius_twin, radius_twin, angle+PI, period );
+		creation.objects[creation.objects_in_galaxy++] = twin;
+
+		reach = radius_sun + sun->get_SystemRadius();
+
+		if ( radius_twin + twin->get_SystemRadius() > reach )
+			reach = radius_twin + twin->get_SystemRadius();
+	}
+
+	// The Orbits are nested Ellipses, stretched to the Height of the
+	// Screen. They never cross, so the Planets never collide.
+	for ( int i = creation.objects_in_galaxy; i < creation.max; i++ ) {
+		Planet *planet = arena->own( new ( *arena ) Planet( arena, seed ) );
+		double radius = reach + ORBITGAP + planet->get_SystemRadius();
+
+		// Stays in the Arena until the next reset()
+		if ( radius + planet->get_SystemRadius() > room_x )
+			continue;
+
+		planet->set_Orbit( arena, center_x, center_y, radius, radius * room_y/room_x,
+			RANDOM_R(2*PI,0,seed), orbit_Period( radius ) );
+		creation.objects[creation.objects_in_galaxy++] = planet;
+
+		reach = radius + planet->get_SystemRadius();
+	}
+
+	for ( int i=0; i < creation.objects_in_galaxy; i++ )
+		creation.final_y[i] = creation.objects[i]->get_Y();
+}
+
+void Galaxy::destroy( Creation &creation )
+{
+	creation.arena->reset();
+	creation.objects_in_galaxy = 0;
+	creation.ready = false;
+}
+	
+void Galaxy::calculate_nextPos( Vector_2 &position, Vector_2 &direction, int ahead )
+{
+	calculate_nextPos( entities, position, direction, ahead );
+}
+
+void Galaxy::calculate_nextPos( const Entities &entities, Vector_2 &position, 
+	Vector_2 &direction, int ahead )
+{
+	double gx = 0, gy = 0;
+
+	entities.add_Gravity( position.getX(), position.getY(), gx, gy, ahead );
+	direction += Vector_2( gx, gy, K );
 
 	position += direction.newLength( direction.getLength() * SHOOT_INTERVAL / 1000 );
 }
 		
-bool Galaxy::animate()
+void Galaxy::calculate_coarsePos( Vector_2 &position, Vector_2 &direction, int ahead, int steps )
 {
-	if ( shoot != NULL && shoot->move(this) ) {
-		shoot->reset();
-		
-		return true;
-	}
+	double gx = 0, gy = 0;
 
-	return false;
+	entities.add_Gravity( position.getX(), position.getY(), gx, gy, ahead, COARSETHETA );
+	direction += Vector_2( gx*steps, gy*steps, K );
+
+	position += direction.newLength( direction.getLength() * SHOOT_INTERVAL * steps / 1000 );
 }
 
-void Galaxy::draw()
+bool Galaxy::animate()
 {
 	is_imploding = animate_BigBang();
 	
 	extra->init(this);
+
+	// Orbiting Planets start when they have fallen into their Places
+	if ( !is_imploding || type != GALAXY_ORBITS )
+		tick++;
+
+	refresh_Entities();
+
+	return projectiles->move( this );
+}
+
+void Galaxy::draw()
+{
 	extra->draw();
 
 	for ( int i=0; i < objects_in_galaxy; i++ )
@@ -1259,8 +2046,44 @@ void Galaxy::draw()
 	for ( int i=0; i < ufos_in_galaxy; i++ )
 		ufos[i]->draw();
 
-	if ( shoot != NULL )
-		shoot->draw();	
+	projectiles->draw();	
+}
+
+void Galaxy::keep_Positions()
+{
+	for ( int i=0; i < objects_in_galaxy; i++ )
+		objects[i]->keep_Position();
+
+	for ( int i=0; i < ufos_in_galaxy; i++ )
+		ufos[i]->keep_Position();
+}
+
+void Galaxy::refresh_Entities()
+{
+	SDL_LockMutex( entities_lock );
+
+	entities.clear();
+
+	// Planets falling into their Places move like pushed ones
+	if ( is_imploding )
+		generation++;
+
+	for ( int i=0; i < objects_in_galaxy; i++ ) {
+		if ( objects[i]->is_Pushed() )
+			generation++;
+
+		objects[i]->set_Tick( tick );
+		objects[i]->store( entities );
+	}
+
+	// Flying Saucers are in the Grid too, so a Shoot only tests the
+	// Saucers near it
+	for ( int i=0; i < ufos_in_galaxy; i++ )
+		ufos[i]->store( entities );
+
+	entities.index();
+
+	SDL_UnlockMutex( entities_lock );
 }
 
 bool Galaxy::animate_BigBang() 
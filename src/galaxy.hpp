@@ -11,10 +11,10 @@
  *
  * Planet, Wormhole, Blackhole - Shown on Screen
  *
- * Ufo - Flying Saucer. An Ufo-Object contains Shoot-Objects
+ * Ufo - Flying Saucer. It launches its Shoots into the Galaxy
  *
  * Galaxy - This Object contains Planets, Wormholes, Blackholes,
- * Ufos and Shoots.
+ * Ufos and the Projectiles of all Shoots.
  *
  *
  *
@@ -37,14 +37,28 @@
 #ifndef __GALAXY_HPP__
 #define __GALAXY_HPP__
 
+#include <SDL/SDL_thread.h>
+
 #include "vector_2.hpp"
 #include "constants.hpp"
 #include "graphics.hpp"
 #include "object.hpp"
 #include "shoot.hpp"
+#include "arena.hpp"
+#include "entities.hpp"
+#include "mask.hpp"
+#include "tasks.hpp"
+#include "shotcache.hpp"
 
 class Galaxy;
-class Shoot;
+class Projectiles;
+class Hintpreview;
+
+enum Galaxytype {
+	GALAXY_PLANETS = 0,
+	GALAXY_ASTEROIDS = 1,	// Hundreds of small Asteroids
+	GALAXY_ORBITS = 2	// Planets fly around one or two Suns
+};
 
 /************************************************************************
  *									*
@@ -81,14 +95,25 @@ private:
 class Stone : public Spaceobject
 {
 public:
-	Stone( double x=0, double y=0, double angle=-1 );
+	// All Randomness of a new Object comes from seed and all Memory
+	// from the Arena of the Galaxy (see Galaxy::create)
+	Stone( Arena *arena, Random *seed, double angle=-1 );
 
 	~Stone();
 
 	void set_Distance( double distance );
+
+	// Farthest Distance from the Planet the Stone reaches
+	double get_Reach() const;
+
+	void set_Tick( int tick );
+
+	void keep_Position();
 	
 	bool check_collision( double x, double y, double width, bool spacing=false );
 
+	void store( Entities &entities, int owner=-1 );
+
 	void draw( bool behind_planet=true );
 
 	void hit( Spaceobject *object );
@@ -99,9 +124,15 @@ private:
 	double x_a, y_a;
 	double speed;
 	double distance;
+
+	// Orbit around the Planet: Offset and Depth at each Tick. After
+	// period Ticks the Stone is back at its Start.
+	int period, phase, keep_phase;
+	float orbit_x[MAXORBIT], orbit_y[MAXORBIT], orbit_z[MAXORBIT];
 	
 	Sprite *stone_sprite,
 		*stone_mask;
+	const Mask *mask;
 };
 
 
@@ -113,12 +144,30 @@ private:
 class Planet : public Spaceobject
 {
 public:
-	Planet( double x=0, double y=0 );
+	Planet( Arena *arena, Random *seed );
 
 	~Planet();
 		
 	bool check_collision( double x, double y, double width, bool spacing = false );
 
+	void store( Entities &entities, int owner=-1 );
+
+	// The Planet flies on an Ellipse around center_x, center_y and is
+	// at angle at Tick 0. Its Positions for all period Ticks are
+	// computed now and taken from the Arena.
+	void set_Orbit( Arena *arena, double center_x, double center_y, 
+		double radius_x, double radius_y, double angle, int period );
+
+	// Bounding Circle of the Planet and its Stones
+	double get_SystemRadius() const;
+
+	// Moves the Planet along its Orbit and away from the last Hit
+	void set_Tick( int tick );
+
+	bool is_Pushed();
+
+	void keep_Position();
+
 	void draw();
 
 	void hit( Spaceobject *object );
@@ -135,8 +184,42 @@ private:
 	} planet_type;
 
 	Sprite *planet_sprite;
+	const Mask *mask;
 	Stone *objects[MAXSTONES];
 	int objects_of_planet;
+	double system_radius;		// Bounding Circle of the Planet and its Stones
+
+	// Ephemeris: Position at each Tick of the Orbit or NULL
+	float *ephemeris_x, *ephemeris_y;
+	int period, phase, last_tick;
+	double orbit_x, orbit_y, orbit_reach;
+};
+
+/************************************************************************
+ *									*
+ * Asteroid								*	
+ *									*
+ ************************************************************************/
+class Asteroid : public Spaceobject
+{
+public:
+	Asteroid( Arena *arena, Random *seed );
+
+	~Asteroid();
+		
+	bool check_collision( double x, double y, double width, bool spacing = false );
+
+	void store( Entities &entities, int owner=-1 );
+
+	void draw();
+
+	void hit( Spaceobject *object );
+	
+private:
+	int shadow;
+	Sprite *asteroid_sprite,
+		*asteroid_mask;
+	const Mask *mask;
 };
 
 /************************************************************************
@@ -147,19 +230,22 @@ private:
 class Blackhole : public Spaceobject
 {
 public:
-	Blackhole( double x=0, double y=0 );
+	Blackhole( Arena *arena, Random *seed );
 
 	~Blackhole();
 		
 	bool check_collision( double x, double y, double width, bool spacing=false );
 
+	void store( Entities &entities, int owner=-1 );
+
 	void draw();
 
 	void hit( Spaceobject *object );
 	
 private:
-	Vector_2 *particles[MAXHOLE];
+	Vector_2 particles[MAXHOLE];
 	Sprite *hole_sprite;
+	Uint32 last_tick;
 	
 };
 
@@ -171,12 +257,14 @@ private:
 class Wormhole : public Spaceobject
 {
 public:
-	Wormhole( double x=0, double y=0 );
+	Wormhole( Arena *arena, Random *seed );
 
 	~Wormhole();
 		
 	bool check_collision( double x, double y, double width, bool spacing = false );
 
+	void store( Entities &entities, int owner=-1 );
+
 	void draw();
 
 	void hit( Spaceobject *object );
@@ -184,8 +272,70 @@ public:
 private:
 	double exit_x, exit_y;
 	double particles[MAXWORM];
-	Vector_2 *start_particles[MAXWORM/15];
+	Vector_2 start_particles[MAXWORM/15];
+	Uint32 last_tick;
+
+};
+
+/************************************************************************
+ *									*
+ * Shootsearch								*	
+ *									*
+ ************************************************************************/
+class Shootsearch : public Task
+{
+public:
+	Shootsearch();
+
+	// Starts searching a Shoot from x, somewhere between top and bottom,
+	// that hits another Team
+	void start( int player_id, double x, double top, double bottom, int factor, Galaxy *galaxy );
+
+	// Forgets the Result, the next Search starts from the beginning
+	void reset();
+
+	bool is_Found() const;
+
+	// Found and a Hit, not the last Configuration after all Searches
+	bool is_Hit() const;
+
+	// False if the Galaxy has changed since the Search started
+	bool is_Current() const;
+
+	// Tests the found Shoot again in the Galaxy as it is now, the Flying
+	// Saucers may have moved. Returns false and forgets it if it
+	// misses or if the Search is not current anymore.
+	bool confirm();
+
+	// The Shoot-configuration, valid when is_Found()
+	double get_Y() const;
 
+	double get_Power() const;
+
+	double get_Angle() const;
+
+	// Tries one random Configuration per Thread of the Jobs
+	bool step();
+
+	// With coarse, each Configuration gets a cheap first Look and only
+	// promising ones are calculated in full (see --finesearch)
+	static void set_Coarse( bool coarse );
+
+private:
+	int player_id;
+	double x, top, bottom;
+	int factor;
+	Galaxy *galaxy;
+	int generation;
+	bool found, hit, looked_up;
+	int searches;
+	double new_y, new_power, new_angle;
+	int tried, calculated;		// Configurations and full Paths of this Move
+	double closest;			// Nearest Miss so far or -1
+
+	static bool coarse;
+
+	void report();
 };
 
 /************************************************************************
@@ -196,6 +346,8 @@ private:
 class Ufo : public Spaceobject
 {
 public:
+	// Ufos on the left Side are red and look to the right, the
+	// others are blue and look to the left
 	Ufo( double x, double y );
 
 	~Ufo();
@@ -226,6 +378,10 @@ public:
 	
 	void deactivate();
 
+	// The Saucer only moves between top and bottom, so Saucers in one
+	// Column never meet
+	void set_Slot( double top, double bottom );
+
 	void move_Up();
 
 	void move_Down();
@@ -236,28 +392,46 @@ public:
 
 	void inc_ShootPower();
 
-	Shoot *shoot();
+	// Launches the bought Weapon into the Galaxy
+	bool shoot( Galaxy *galaxy );
 	
 	bool calculate_Computer_Move( Galaxy *galaxy, int factor );
 
+	// Searches a Shoot in the Background while the others aim and
+	// Shoots fly, so the next Turn starts with it
+	void ponder( Galaxy *galaxy, int factor );
+
 	bool check_collision( double x, double y, double width, bool spacing = false );
 
 	void draw();
 	
-	void draw_hint( Galaxy *galaxy );
+	// The Hint of the Shoot from here at the Angle of the Saucer
+	void draw_hint( Hintpreview *preview );
 
 	void hit( Spaceobject *object );
 
+	// Ufos of the same Team don't shoot at each other
+	void set_Team( int team );
+
+	int get_Team() const;
+
+	void store( Entities &entities, int owner=-1 );
+
 private:
 	int player_id;
+	int team;
 	bool is_human,
 		is_active,
-		is_locked;
+		is_locked,
+		is_confirmed;
 	int shield_strength;
 	int bonus;
+	int rechecks;			// Searches left this Turn if the Hit misses after aiming
 	WeaponId bought_weapon;
 	double shoot_power,
 		shoot_angle;
+	double slot_top,
+		slot_bottom;
 	
 	enum { 
 		NONE,
@@ -270,6 +444,8 @@ private:
 		*thinking_sprite,
 		*shooting_sprite;
 	
+	Shootsearch search;
+
 	static int current_playerid;
 
 	void draw_Targetmode();
@@ -297,11 +473,19 @@ public:
 	
 	bool is_Imploding() const;
 
+	// Is an Ufo of another Team than player_id near x, y?
 	bool is_Ufo_In_Area( int player_id, double x, double y, double factor );
+
+	// Puts the living Flying Saucers of other Teams than player_id into
+	// enemies (room for MAXPLAYER) and returns how many there are
+	int find_Enemies( int player_id, Ufo **enemies ) const;
 	
 	void set_Ufos( Ufo **ufos, int max );
 
-	void set_Shoot( Shoot *shoot );
+	// Returns false if too many Projectiles are flying
+	bool launch( int weapon, Vector_2 start, Vector_2 vector );
+
+	double get_ShootWidth( int weapon ) const;
 
 	void kill_all_Shoots();
 	
@@ -309,14 +493,59 @@ public:
 
 	bool has_collision( Spaceobject *object );
 	
-	bool check_collision( double x, double y, double width, bool spacing = false );
+	// Stones are where they will be in ahead Ticks. Flying Saucers count.
+	bool check_collision( double x, double y, double width, bool spacing = false, int ahead = 0 );
+
+	int get_Tick() const;
+
+	// Threads besides the Game (see Hintpreview) calculate in their own
+	// Copy of the Entities. The Game only waits while it is copied.
+	void copy_Entities( Entities &copy );
+
+	// Changes when a new Galaxy is created or a Hit pushes a Planet.
+	// A Shoot searched in another Generation may miss.
+	int get_Generation() const;
+
+	// Where Shoots of player_id are kept in the Shotcache: the Seed and
+	// Planets of this Galaxy, the Band of the Shooter and of all
+	// Flying Saucers of other Teams
+	Shotcache::Key get_CacheKey( int player_id ) const;
+
+	// Finds a Place for an Object of that Width (with Spacing) that keeps
+	// border_x and border_y away from the Screenborders. Returns false if
+	// the Galaxy is too crowded.
+	bool find_Place( double width, double border_x, double border_y, 
+		Random *seed, double &x, double &y );
 	
-	bool create( int max, int seed );
+	// max may be up to MAXGALAXYOBJECTS. If not all Planets find a Place,
+	// the Galaxy gets less.
+	bool create( int max, int seed, Galaxytype type = GALAXY_PLANETS );
+
+	// Creates the Galaxy for the next create() in the Background.
+	// If create() is called with the same max, seed and type, the
+	// Warp only exchanges the Planets.
+	void prepare( int max, int seed, Galaxytype type = GALAXY_PLANETS );
 	
-	void calculate_nextPos( Vector_2 &position, Vector_2 &direction );
+	// Moves the Shoot one Step with the Gravity of ahead Ticks
+	void calculate_nextPos( Vector_2 &position, Vector_2 &direction, int ahead = 0 );
+
+	// The same in a Copy of the Entities (see copy_Entities)
+	static void calculate_nextPos( const Entities &entities, Vector_2 &position, 
+		Vector_2 &direction, int ahead = 0 );
+
+	// Moves the Shoot steps Steps at once, far Planets pull together
+	// (see COARSETHETA). Only for a first Look at a Path.
+	void calculate_coarsePos( Vector_2 &position, Vector_2 &direction, int ahead, int steps );
 
+	// Keeps where everything is before a Step of the Game, so it can
+	// be drawn between the Steps. Call it before anything moves.
+	void keep_Positions();
+
+	// One Step of the Game. Returns true if the Shoot is finished.
 	bool animate();
 	
+	// Draws everything between the last and this Step (see
+	// Spaceobject::set_Blend)
 	void draw();
 	
 private:
@@ -324,16 +553,49 @@ private:
 	int objects_in_galaxy;
 	int ufos_in_galaxy;
 	
-	Spaceobject *objects[MAXPLANETS];
+	Spaceobject *objects[MAXGALAXYOBJECTS];
+	Arena *arena;
+	Entities entities;
+	Galaxytype type;
+	int tick;
+	int generation;
+	int seed, planets;
 	Ufo **ufos;
-	Shoot *shoot;
+	Projectiles *projectiles;
 	Extra *extra;
 
 	struct {
 		double x, y;
-	} animate_position[MAXPLANETS];
+	} animate_position[MAXGALAXYOBJECTS];
+
+	// Planets of a Galaxy that is not shown
+	struct Creation {
+		int max, seed;
+		Galaxytype type;
+		bool ready;
+		int objects_in_galaxy;
+		Arena *arena;
+		Spaceobject *objects[MAXGALAXYOBJECTS];
+		double final_y[MAXGALAXYOBJECTS];
+	} next, retired;
+
+	SDL_Thread *creator;
+	SDL_mutex *entities_lock;
 
 	bool animate_BigBang();
+
+	// Moves the Objects to the Tick and copies them into the Entities
+	void refresh_Entities();
+
+	void wait_for_Creator();
+
+	static int creator_Thread( void *galaxy );
+
+	static void generate( Creation &creation );
+
+	static void generate_Orbits( Creation &creation, Random *seed );
+
+	static void destroy( Creation &creation );
 };
 
 #endif
@@ -26,10 +26,26 @@
 #include <iostream>
 #include <stdio.h>
 #include <cmath>
+#include <map>
 
 #include <SDL_image.h>
+#include <SDL/SDL_thread.h>
 
 #include "graphics.hpp"
+#include "pack.hpp"
+#include "loader.hpp"
+#include "renderlist.hpp"
+
+extern Pack *pack;
+extern Loader *loader;
+
+// All loaded Pictures. Sprites with the same Picture share one Surface.
+// The Galaxy creates Sprites in a Thread, so the List is locked.
+static std::map<std::string, SDL_Surface *> loaded_surfaces;
+static SDL_mutex *loaded_lock = NULL;
+
+// The GIF-Decoder of SDL_image keeps its State in static Variables
+static SDL_mutex *decode_lock = NULL;
 
 /******************************************************************************************
  *
@@ -40,18 +56,7 @@ Font::Font()
 {
 	verbose( "Initializing Font" );
 	
-	if ( ( font_image=IMG_Load( "gfx/font.gif" ) ) == NULL ) {
-		std::cout << "Error in Font: " << SDL_GetError() << std::endl;
-		exit(1);
-	}
-	
-	if ( SCREENFACTOR != 1 ) 
-		font_image = Sprite::zoom(font_image, SCREENFACTOR);
-
-	SDL_SetColorKey( font_image, 
-		SDL_RLEACCEL | SDL_SRCCOLORKEY, 
-		SDL_MapRGB( font_image->format, 255, 0, 255 ) );
-	font_image = SDL_DisplayFormat(font_image);
+	font_image = Sprite::load( "gfx/font.gif" );
 	
 	// From SPACE 
 	int font_sizes[] = {
@@ -76,7 +81,7 @@ Font::~Font()
 {
 	verbose( "Deleting Font" );
 
-	SDL_FreeSurface(font_image);
+	Sprite::release( font_image );
 }
 
 int Font::getLineHeight() const 
@@ -91,7 +96,10 @@ void Font::print( int x, int y, std::string txt, int alpha )
 	dst.y = y;
 	dst.x = x;
 	
-	SDL_SetAlpha( font_image, SDL_SRCALPHA, alpha );
+	Renderlist *list = Renderlist::get_Recording();
+
+	if ( list == NULL )
+		SDL_SetAlpha( font_image, SDL_SRCALPHA, alpha );
 
 	for ( int i=0; i < (int)txt.length(); i++ ) {
 		int srcp = (int)txt[i]-32;
@@ -103,8 +111,13 @@ void Font::print( int x, int y, std::string txt, int alpha )
 			if ( dst.x > SCREENWIDTH || dst.y > SCREENHEIGHT ) 
 				break;
 
-			if ( dst.x + dst.w >= 0 && dst.y + dst.h >= 0 && src.w > 0 )
-				SDL_BlitSurface( font_image, &src, MYSDLSCREEN, &dst );
+			if ( dst.x + dst.w >= 0 && dst.y + dst.h >= 0 && src.w > 0 ) {
+
+				if ( list != NULL )
+					list->blit( font_image, src, dst, alpha );
+				else
+					SDL_BlitSurface( font_image, &src, MYSDLSCREEN, &dst );
+			}
 
 		}	
 		x += font_width[srcp];
@@ -138,22 +151,12 @@ Sprite::Sprite( char* filename, int frames ) :
 	frames(frames), 
 	actual_frame(0),
 	frame_delay(ANIMFRAME),
-	frame_rate(ANIMFRAME)
+	frame_rate(ANIMFRAME),
+	last_tick(Sprite::tick)
 {
 	verbose( "Initializing Sprite: " + std::string(filename) );
 
-	if ( ( sprite_image = IMG_Load( filename ) ) == NULL ) {
-		std::cout << "Error in Sprite: " << SDL_GetError() << std::endl;
-		exit(1);
-	}
-
-	if ( SCREENFACTOR != 1 ) 
-		sprite_image = Sprite::zoom(sprite_image, SCREENFACTOR);
-
-	SDL_SetColorKey( sprite_image, 
-		SDL_RLEACCEL | SDL_SRCCOLORKEY, 
-		SDL_MapRGB( sprite_image->format, 255, 0, 255 ) );
-	sprite_image = SDL_DisplayFormat(sprite_image);
+	sprite_image = Sprite::load( filename );
 
 	width = sprite_image->w / frames;
 	height = sprite_image->h;
@@ -163,15 +166,120 @@ Sprite::~Sprite()
 {
 	verbose( "Deleting Sprite" );
 	
-	SDL_FreeSurface( sprite_image );
+	Sprite::release( sprite_image );
 }	
 
+SDL_Surface *Sprite::load( const char *filename )
+{
+	SDL_LockMutex( loaded_lock );
+
+	std::map<std::string, SDL_Surface *>::iterator i = loaded_surfaces.find( filename );
+
+	if ( i != loaded_surfaces.end() ) {
+		i->second->refcount++;
+		SDL_UnlockMutex( loaded_lock );
+		return i->second;
+	}
+
+	SDL_Surface *image = NULL;
+
+	// A Pack already contains zoomed Pictures in Displayformat
+	if ( pack != NULL )
+		image = pack->get_Surface( filename );
+
+	if ( image == NULL ) {
+		SDL_Surface *picture = NULL;
+
+		// The Loader may have decoded it already
+		if ( loader != NULL )
+			picture = loader->get_Picture( filename );
+
+		if ( picture == NULL && ( picture = Sprite::decode( filename ) ) == NULL ) {
+			std::cout << "Error in Sprite: " << SDL_GetError() << std::endl;
+			exit(1);
+		}
+
+		image = SDL_DisplayFormat( picture );
+		SDL_FreeSurface( picture );
+	}
+
+	// One Reference stays in the List, one goes to the Caller
+	loaded_surfaces[filename] = image;
+	image->refcount++;
+
+	SDL_UnlockMutex( loaded_lock );
+
+	return image;
+}
+
+void Sprite::release( SDL_Surface *surface )
+{
+	SDL_LockMutex( loaded_lock );
+	SDL_FreeSurface( surface );
+	SDL_UnlockMutex( loaded_lock );
+}
+
+SDL_Surface *Sprite::decode( const char *filename )
+{
+	SDL_LockMutex( decode_lock );
+	SDL_Surface *picture = IMG_Load( filename );
+	SDL_UnlockMutex( decode_lock );
+
+	if ( picture == NULL )
+		return NULL;
+
+	if ( SCREENFACTOR != 1 ) {
+		SDL_Surface *zoomed = Sprite::zoom( picture, SCREENFACTOR );
+		SDL_FreeSurface( picture );
+		picture = zoomed;
+	}
+
+	SDL_SetColorKey( picture, 
+		SDL_RLEACCEL | SDL_SRCCOLORKEY, 
+		SDL_MapRGB( picture->format, 255, 0, 255 ) );
+
+	return picture;
+}
+
+void Sprite::init()
+{
+	loaded_lock = SDL_CreateMutex();
+	decode_lock = SDL_CreateMutex();
+}
+
 void Sprite::setOffset( int x, int y )
 {
 	x_offset = x;
 	y_offset = y; 
 }
 
+void Sprite::next_Tick()
+{
+	tick++;
+}
+
+void Sprite::lockScreen()
+{
+	if ( Renderlist::get_Recording() == NULL )
+		SDL_LockSurface( MYSDLSCREEN );
+}
+
+void Sprite::unlockScreen()
+{
+	if ( Renderlist::get_Recording() == NULL )
+		SDL_UnlockSurface( MYSDLSCREEN );
+}
+
+void Sprite::fillScreen( Uint32 color )
+{
+	Renderlist *list = Renderlist::get_Recording();
+
+	if ( list != NULL )
+		list->fill( color );
+	else
+		SDL_FillRect( MYSDLSCREEN, NULL, color );
+}
+
 bool Sprite::is_onLastFrame()
 {
 	return ( actual_frame == frames-1 && frame_delay == 0 ) ? true : false;
@@ -220,8 +328,19 @@ void Sprite::draw()
 	sprite_rect.w = width;
 	sprite_rect.h = height;
 
-	SDL_SetAlpha( sprite_image, SDL_SRCALPHA, alpha);
-	SDL_BlitSurface( sprite_image, &sprite_rect, MYSDLSCREEN, &rect );
+	Renderlist *list = Renderlist::get_Recording();
+
+	if ( list != NULL )
+		list->blit( sprite_image, sprite_rect, rect, alpha );
+	else {
+		SDL_SetAlpha( sprite_image, SDL_SRCALPHA, alpha);
+		SDL_BlitSurface( sprite_image, &sprite_rect, MYSDLSCREEN, &rect );
+	}
+
+	if ( last_tick == tick )
+		return;
+
+	last_tick = tick;
 		
 	if ( frame_delay-- < 1 ) {
 		frame_delay = frame_rate;
@@ -240,6 +359,14 @@ void Sprite::putpixel( int x, int y, Uint32 pixel, SDL_Surface *screen )
 {
 	// NOTE: The surface must be locked before calling this!
 	if ( x >= 0 && x < SCREENWIDTH && y >= 0 && y < SCREENHEIGHT) {
+
+		Renderlist *list = ( screen == MYSDLSCREEN ) ? Renderlist::get_Recording() : NULL;
+
+		if ( list != NULL ) {
+			list->pixel( x, y, pixel );
+			return;
+		}
+		
 		
 		int bpp = screen->format->BytesPerPixel;
 		/* Here p is the address to the pixel we want to set */
@@ -414,7 +541,8 @@ SDL_Surface *Sprite::zoom( SDL_Surface *surface, double factor )
 	
 	int z_width = (int)(width*factor);
 	int z_height = (int)(height*factor);
-	SDL_Surface *zoom_surface = SDL_CreateRGBSurface( SDL_HWSURFACE | SDL_SRCCOLORKEY, z_width, z_height, 32, rmask, gmask, bmask, amask );
+	// Software-Surface: zoom() is called by the Loader-Threads, too
+	SDL_Surface *zoom_surface = SDL_CreateRGBSurface( SDL_SWSURFACE | SDL_SRCCOLORKEY, z_width, z_height, 32, rmask, gmask, bmask, amask );
 
 	SDL_LockSurface(surface);
 	SDL_LockSurface(zoom_surface);
@@ -436,6 +564,7 @@ SDL_Surface *Sprite::zoom( SDL_Surface *surface, double factor )
 
 int Sprite::x_offset = 0;
 int Sprite::y_offset = 0;
+Uint32 Sprite::tick = 0;
 
 /******************************************************************************************
  *
@@ -447,12 +576,17 @@ Star::Star()
 	x(rx()),
 	y(ry()),
 	b(blink()),
-	c(color())
+	c(color()),
+	last_tick(Sprite::tick)
 {}
 
 void Star::draw()
 {
-	if ( b-- == 0 ) b=blink();
+	if ( last_tick != Sprite::tick ) {
+		last_tick = Sprite::tick;
+
+		if ( b-- == 0 ) b=blink();
+	}
 
 	if ( b>5 ) {
 		Sprite::putpixel( x, y, SDL_MapRGB( MYSDLSCREEN->format, c, c, c ));
@@ -467,22 +601,22 @@ void Star::draw()
 
 int Star::rx() 
 {
-	return (int)RANDOM( SCREENWIDTH-20, 20);
+	return (int)RANDOM_FX( SCREENWIDTH-20, 20);
 }
 
 int Star::ry()
 {
-	return (int)RANDOM( SCREENHEIGHT-20, 20);
+	return (int)RANDOM_FX( SCREENHEIGHT-20, 20);
 }
 
 int Star::color() 
 {
-	return (int)RANDOM( 245,25 );
+	return (int)RANDOM_FX( 245,25 );
 }
 
 int Star::blink() 
 { 
-	return (int)RANDOM( 2000,1 );
+	return (int)RANDOM_FX( 2000,1 );
 }
 
 /******************************************************************************************
@@ -495,12 +629,17 @@ Shootingstar::Shootingstar()
 	x(rx()),
 	y(ry()),
 	s(speed()),
-	w(wait())
+	w(wait()),
+	last_tick(Sprite::tick)
 {}
 
 void Shootingstar::draw()
 {
-	if ( w-- == 0 ) {
+	bool next = ( last_tick != Sprite::tick );
+
+	last_tick = Sprite::tick;
+
+	if ( next && w-- == 0 ) {
 		w = wait();
 		x = rx();
 		y = ry();
@@ -518,29 +657,32 @@ void Shootingstar::draw()
 			int y = (int)(this->y + as * i);
 			Sprite::putpixel( x, y, SDL_MapRGB( MYSDLSCREEN->format, c, c, c + 20 ));
 		}
-		x += s * 4;
-		y += as * 4;
+
+		if ( next ) {
+			x += s * 4;
+			y += as * 4;
+		}
 	}
 }
 
 double Shootingstar::rx() 
 {
-	return (int)RANDOM( SCREENWIDTH-200, 200);
+	return (int)RANDOM_FX( SCREENWIDTH-200, 200);
 }
 
 double Shootingstar::ry()
 {
-	return (int)RANDOM( SCREENHEIGHT-200, 100);
+	return (int)RANDOM_FX( SCREENHEIGHT-200, 100);
 }
 
 double Shootingstar::speed()
 {
-	return ( (int)RANDOM(2,0)==1 ) ? 1 : -1;
+	return ( (int)RANDOM_FX(2,0)==1 ) ? 1 : -1;
 }
 
 int Shootingstar::wait() 
 { 
-	return (int)RANDOM(2000,1000);
+	return (int)RANDOM_FX(2000,1000);
 }
 
 /******************************************************************************************
@@ -558,9 +700,10 @@ Goldrain::Goldrain()
 	b(blink()),
 	cr(0),
 	cg(0),
-	cb(0)
+	cb(0),
+	last_tick(Sprite::tick)
 {
-	switch ((int)RANDOM(4,0)) {
+	switch ((int)RANDOM_FX(4,0)) {
 
 		case 0:
 			cr = color();
@@ -587,16 +730,21 @@ void Goldrain::setOffset(int x, int y)
 
 void Goldrain::draw()
 {
-	if ( (y += sp ) > 100 ) {
-		y -= 100;
-		x = (double)rx();
-	}
+	if ( last_tick != Sprite::tick ) {
+		last_tick = Sprite::tick;
+
+		if ( (y += sp ) > 100 ) {
+			y -= 100;
+			x = (double)rx();
+		}
 	
-	x += (int)( 4 * (rand()/(RAND_MAX+1.0) ) -2 );
+		x += (int)RANDOM_FX( 2,-2 );
 	
-	if ( b-- == 0 )
-		b = blink();
-	else if ( b > 1 && y >= 0 ) {
+		if ( b-- == 0 )
+			b = blink();
+	}
+
+	if ( b > 1 && y >= 0 ) {
 		int r = (int)( cr*y/110 ) + 40;
 		int g = (int)( cg*y/110 ) + 40;
 		int b = (int)( cb*y/110 ) + 40;
@@ -616,26 +764,26 @@ void Goldrain::draw()
 
 double Goldrain::rx() 
 {
-	return RANDOM( 40,-40 );
+	return RANDOM_FX( 40,-40 );
 }
 
 double Goldrain::ry() 
 {
-	return RANDOM( 100,0 );
+	return RANDOM_FX( 100,0 );
 }
 
 double Goldrain::speed()
 {
-	return RANDOM( 2,1 );
+	return RANDOM_FX( 2,1 );
 }
 
 int Goldrain::color() 
 {
-	return (int)RANDOM( 255, 100 );
+	return (int)RANDOM_FX( 255, 100 );
 }
 
 int Goldrain::blink()
 {
-	return (int)RANDOM( 10,0 );
+	return (int)RANDOM_FX( 10,0 );
 }
 
@@ -85,12 +85,41 @@ class Sprite
 public:	
 	static int x_offset, y_offset;
 
+	// Step of the Game. Animations go on once per Step, however
+	// often they are drawn.
+	static Uint32 tick;
+
 	Sprite( char* filename, int frames=1 );
 
 	~Sprite();
 
+	// Creates the Locks of the loaded Pictures. Call it after SDL_Init()
+	// and before the first Sprite.
+	static void init();
+
 	static void setOffset( int x, int y );
 
+	static void next_Tick();
+
+	// Lock and fill the Screen unless the Frame is recorded (see
+	// Renderlist)
+	static void lockScreen();
+
+	static void unlockScreen();
+
+	static void fillScreen( Uint32 color );
+
+	// Returns a Picture (zoomed, colorkeyed and in Displayformat).
+	// Each Picture is loaded only once. Free it with release().
+	static SDL_Surface *load( const char *filename );
+
+	static void release( SDL_Surface *surface );
+
+	// Loads a Picture from File, zoomed and colorkeyed. Doesn't touch
+	// the Display, so it may be called from any Thread. Returns NULL
+	// on Errors (see SDL_GetError()).
+	static SDL_Surface *decode( const char *filename );
+
 	bool is_onLastFrame();
 	
 	int getWidth();
@@ -120,6 +149,7 @@ private:
 		actual_frame,
 		frame_delay,
 		frame_rate;
+	Uint32 last_tick;
 };
 
 /******************************************************************************************
@@ -139,6 +169,7 @@ public:
 	
 private:
 	int x, y, b, c;
+	Uint32 last_tick;
 
 	int rx();
 
@@ -168,6 +199,7 @@ public:
 private:
 	double x, y, s;
 	int w;
+	Uint32 last_tick;
 
 	double rx();
 
@@ -199,6 +231,7 @@ public:
 private:
 	double x, y, sp, xoffset, yoffset;
 	int b, cr, cg, cb ;
+	Uint32 last_tick;
 	
 	double rx();
 
@@ -0,0 +1,249 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "jobs.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <sstream>
+
+#include "jobs.hpp"
+
+/******************************************************************************************
+ *
+ * Jobs
+ *
+ ******************************************************************************************/
+Jobs::Jobs( int amount )
+:
+	unfinished(0),
+	generation(0),
+	quit(false)
+{
+	std::ostringstream info;
+	info << "Initializing Jobs with " << amount << " Workers";
+	verbose( info.str() );
+
+	lock = SDL_CreateMutex();
+	started = SDL_CreateCond();
+	pushed = SDL_CreateCond();
+
+	queues.resize( amount+1 );
+
+	for ( int i=0; i < (int)queues.size(); i++ )
+		queues[i].lock = SDL_CreateMutex();
+
+	// The Threads get Pointers into it, so it never grows again
+	workers.resize( amount+1 );
+
+	for ( int i=1; i <= amount; i++ ) {
+		workers[i].jobs = this;
+		workers[i].id = i;
+		threads.push_back( SDL_CreateThread( Jobs::worker_Thread, &workers[i] ) );
+	}
+}
+
+Jobs::~Jobs()
+{
+	verbose( "Deleting Jobs" );
+
+	SDL_LockMutex( lock );
+	quit = true;
+	SDL_CondBroadcast( started );
+	SDL_UnlockMutex( lock );
+
+	for ( int i=0; i < (int)threads.size(); i++ )
+		SDL_WaitThread( threads[i], NULL );
+
+	for ( int i=0; i < (int)queues.size(); i++ )
+		SDL_DestroyMutex( queues[i].lock );
+
+	SDL_DestroyCond( pushed );
+	SDL_DestroyCond( started );
+	SDL_DestroyMutex( lock );
+}
+
+int Jobs::get_Workers() const
+{
+	return (int)threads.size();
+}
+
+int Jobs::add( Function function, void *data, const int *after, int amount )
+{
+	Job job;
+
+	job.function = function;
+	job.data = data;
+	job.waiting = amount;
+
+	jobs.push_back( job );
+
+	int me = (int)jobs.size()-1;
+
+	for ( int i=0; i < amount; i++ )
+		jobs[ after[i] ].next.push_back( me );
+
+	return me;
+}
+
+void Jobs::run()
+{
+	if ( jobs.empty() )
+		return;
+
+	// A Worker may still look for Jobs of the last run(), so the
+	// Count is set before the first Job is pushed
+	SDL_LockMutex( lock );
+	unfinished = (int)jobs.size();
+	SDL_UnlockMutex( lock );
+
+	// Jobs that wait for nobody are spread over all Queues
+	int queue = 0;
+
+	for ( int i=0; i < (int)jobs.size(); i++ )
+		if ( jobs[i].waiting == 0 ) {
+			push( queue, i );
+			queue = ( queue+1 ) % queues.size();
+		}
+
+	SDL_LockMutex( lock );
+	generation++;
+	SDL_CondBroadcast( started );
+	SDL_UnlockMutex( lock );
+
+	work( 0 );
+
+	jobs.clear();
+}
+
+void Jobs::work( int id )
+{
+	while ( true ) {
+		int job;
+
+		if ( take( id, job ) ) {
+
+			if ( jobs[job].function != NULL )
+				jobs[job].function( jobs[job].data );
+
+			done( id, job );
+			continue;
+		}
+
+		// Nothing to take: everything is done or the Jobs that are
+		// left wait for others
+		SDL_LockMutex( lock );
+
+		if ( unfinished == 0 ) {
+			SDL_UnlockMutex( lock );
+			return;
+		}
+
+		SDL_CondWaitTimeout( pushed, lock, 1 );
+		SDL_UnlockMutex( lock );
+	}
+}
+
+bool Jobs::take( int id, int &job )
+{
+	Queue &own = queues[id];
+	bool found = false;
+
+	SDL_LockMutex( own.lock );
+
+	if ( !own.jobs.empty() ) {
+		job = own.jobs.back();
+		own.jobs.pop_back();
+		found = true;
+	}
+
+	SDL_UnlockMutex( own.lock );
+
+	// Steal the oldest Job of another Thread
+	for ( int i=1; !found && i < (int)queues.size(); i++ ) {
+		Queue &other = queues[ ( id+i ) % queues.size() ];
+
+		SDL_LockMutex( other.lock );
+
+		if ( !other.jobs.empty() ) {
+			job = other.jobs.front();
+			other.jobs.pop_front();
+			found = true;
+		}
+
+		SDL_UnlockMutex( other.lock );
+	}
+
+	return found;
+}
+
+void Jobs::push( int id, int job )
+{
+	SDL_LockMutex( queues[id].lock );
+	queues[id].jobs.push_back( job );
+	SDL_UnlockMutex( queues[id].lock );
+}
+
+void Jobs::done( int id, int job )
+{
+	SDL_LockMutex( lock );
+
+	// The Jobs that waited only for this one go on in the same Thread
+	for ( int i=0; i < (int)jobs[job].next.size(); i++ ) {
+		int next = jobs[job].next[i];
+
+		if ( --jobs[next].waiting == 0 )
+			push( id, next );
+	}
+
+	if ( --unfinished == 0 || !jobs[job].next.empty() )
+		SDL_CondBroadcast( pushed );
+
+	SDL_UnlockMutex( lock );
+}
+
+int Jobs::worker_Thread( void *data )
+{
+	Worker *worker = (Worker *)data;
+	Jobs *jobs = worker->jobs;
+	int generation = 0;
+
+	SDL_LockMutex( jobs->lock );
+
+	while ( true ) {
+
+		while ( !jobs->quit && jobs->generation == generation )
+			SDL_CondWait( jobs->started, jobs->lock );
+
+		if ( jobs->quit )
+			break;
+
+		generation = jobs->generation;
+
+		SDL_UnlockMutex( jobs->lock );
+		jobs->work( worker->id );
+		SDL_LockMutex( jobs->lock );
+	}
+
+	SDL_UnlockMutex( jobs->lock );
+
+	return 0;
+}
@@ -0,0 +1,109 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "jobs.hpp"
+ *
+ * Jobs - Runs a Graph of small Jobs on some Worker-Threads. A Job
+ * starts when all Jobs it waits for are done. Each Thread keeps its
+ * own Queue and steals from the others when it runs out of Work.
+ * Set the Number of Workers with "ufo --workers N".
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __JOBS_HPP__
+#define __JOBS_HPP__
+
+#include <vector>
+#include <deque>
+
+#include <SDL/SDL.h>
+#include <SDL/SDL_thread.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Jobs
+ *
+ ******************************************************************************************/
+class Jobs
+{
+public:
+	typedef void (*Function)( void *data );
+
+	// workers Threads help the Thread that calls run(). With 0
+	// Workers it does all Jobs alone.
+	Jobs( int workers );
+
+	~Jobs();
+
+	int get_Workers() const;
+
+	// Adds a Job that starts when the amount Jobs in after are done
+	// and returns its Number. A Job without Function only waits, so
+	// later Jobs can wait for a whole Stage.
+	int add( Function function, void *data, const int *after = NULL, int amount = 0 );
+
+	// Runs all added Jobs and returns when they are done. After that
+	// the next Graph may be added.
+	void run();
+
+private:
+	struct Job {
+		Function function;
+		void *data;
+		int waiting;			// Jobs it still waits for
+		std::vector<int> next;		// Jobs that wait for it
+	};
+
+	// A Thread takes its own Jobs from the back and steals from the
+	// front of the other Queues
+	struct Queue {
+		std::deque<int> jobs;
+		SDL_mutex *lock;
+	};
+
+	struct Worker {
+		Jobs *jobs;
+		int id;
+	};
+
+	std::vector<Job> jobs;
+	std::vector<Queue> queues;		// Queue 0 belongs to the Caller of run()
+	std::vector<Worker> workers;
+	std::vector<SDL_Thread *> threads;
+	int unfinished, generation;
+	bool quit;
+	SDL_mutex *lock;
+	SDL_cond *started, *pushed;
+
+	void work( int id );
+
+	bool take( int id, int &job );
+
+	void push( int id, int job );
+
+	void done( int id, int job );
+
+	static int worker_Thread( void *worker );
+};
+
+#endif
@@ -0,0 +1,193 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "loader.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <iostream>
+#include <sstream>
+
+#ifndef __WIN32__
+#include <unistd.h>
+#endif
+
+#include "graphics.hpp"
+#include "sound.hpp"
+#include "pack.hpp"
+#include "loader.hpp"
+
+extern Pack *pack;
+
+const int MAXLOADERTHREADS = 8;
+
+/******************************************************************************************
+ *
+ * Loader
+ *
+ ******************************************************************************************/
+Loader::Loader( int amount )
+:
+	next_job(0)
+{
+	std::ostringstream info;
+	info << "Initializing Loader with " << amount << " Threads";
+	verbose( info.str() );
+
+	lock = SDL_CreateMutex();
+	finished = SDL_CreateCond();
+
+	// Everything that is in the Pack needs no decoding
+	for ( int i=0; i < _SOUNDSETNAMES + _GFXNAMES; i++ ) {
+		Job job;
+
+		job.is_audio = i < _SOUNDSETNAMES;
+		job.name = ( job.is_audio ) ? SOUNDSETNAMES[i] : GFXNAMES[i-_SOUNDSETNAMES];
+		job.done = false;
+		job.taken = false;
+		job.picture = NULL;
+		job.sample = NULL;
+		job.length = 0;
+
+		if ( pack == NULL || !pack->contains( job.name ) )
+			jobs.push_back( job );
+	}
+
+	if ( amount > MAXLOADERTHREADS )
+		amount = MAXLOADERTHREADS;
+
+	for ( int i=0; i < amount && i < (int)jobs.size(); i++ )
+		threads.push_back( SDL_CreateThread( Loader::work, this ) );
+}
+
+Loader::~Loader()
+{
+	verbose( "Deleting Loader" );
+
+	for ( int i=0; i < (int)threads.size(); i++ )
+		SDL_WaitThread( threads[i], NULL );
+
+	// Free all Data nobody asked for
+	for ( int i=0; i < (int)jobs.size(); i++ ) {
+		if ( !jobs[i].taken ) {
+			if ( jobs[i].picture != NULL )
+				SDL_FreeSurface( jobs[i].picture );
+
+			free( jobs[i].sample );
+		}
+	}
+
+	SDL_DestroyCond( finished );
+	SDL_DestroyMutex( lock );
+}
+
+SDL_Surface *Loader::get_Picture( std::string name )
+{
+	Job *job = wait_for( name, false );
+
+	return ( job == NULL ) ? NULL : job->picture;
+}
+
+Uint8 *Loader::get_Audio( std::string name, Uint32 &length )
+{
+	Job *job = wait_for( name, true );
+
+	if ( job == NULL )
+		return NULL;
+
+	length = job->length;
+
+	return job->sample;
+}
+
+int Loader::processors()
+{
+	int amount = 1;
+
+	#if !defined(__WIN32__) && defined(_SC_NPROCESSORS_ONLN)
+	amount = (int)sysconf( _SC_NPROCESSORS_ONLN );
+	#endif
+
+	return ( amount < 1 ) ? 1 : amount;
+}
+
+Loader::Job *Loader::wait_for( std::string name, bool is_audio )
+{
+	Job *job = NULL;
+
+	SDL_LockMutex( lock );
+
+	for ( int i=0; i < (int)jobs.size(); i++ )
+		if ( jobs[i].is_audio == is_audio && !jobs[i].taken && name == jobs[i].name )
+			job = &jobs[i];
+
+	if ( job != NULL ) {
+
+		while ( !job->done )
+			SDL_CondWait( finished, lock );
+
+		job->taken = true;
+	}
+
+	SDL_UnlockMutex( lock );
+
+	return job;
+}
+
+int Loader::work( void *data )
+{
+	Loader *loader = (Loader *)data;
+
+	while ( true ) {
+		SDL_LockMutex( loader->lock );
+
+		if ( loader->next_job >= (int)loader->jobs.size() ) {
+			SDL_UnlockMutex( loader->lock );
+			return 0;
+		}
+
+		// The Vector is never resized while Threads are running
+		Job *job = &loader->jobs[ loader->next_job++ ];
+
+		SDL_UnlockMutex( loader->lock );
+
+		SDL_Surface *picture = NULL;
+		Uint8 *sample = NULL;
+		Uint32 length = 0;
+
+		// Only Pictures wait for each other (see Sprite::decode). Errors
+		// leave the Job empty and are reported by the Main-Thread.
+		if ( job->is_audio )
+			sample = Soundset::convert( job->name, length );
+		else
+			picture = Sprite::decode( job->name );
+
+		SDL_LockMutex( loader->lock );
+
+		job->picture = picture;
+		job->sample = sample;
+		job->length = length;
+		job->done = true;
+
+		SDL_CondBroadcast( loader->finished );
+		SDL_UnlockMutex( loader->lock );
+	}
+}
@@ -0,0 +1,89 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "loader.hpp"
+ *
+ * Loader - Decodes all Pictures and Sounds of the Game with some
+ * Threads at the same time. Sprite and Soundset take their Data
+ * from the Loader; only the Conversion to the Displayformat is
+ * done in the Main-Thread (SDL wants it so). SDL_image reads one
+ * Picture at a time, Zooming and Sounds run in parallel.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __LOADER_HPP__
+#define __LOADER_HPP__
+
+#include <vector>
+
+#include <SDL/SDL.h>
+#include <SDL/SDL_thread.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Loader
+ *
+ ******************************************************************************************/
+class Loader
+{
+public:
+	Loader( int threads = processors() );
+
+	~Loader();
+
+	// Waits until the Picture is decoded (zoomed and colorkeyed, but not
+	// in Displayformat). Returns NULL if the Loader doesn't load it or
+	// failed, the Caller then loads it itself and reports the Error.
+	// The Caller owns the Surface.
+	SDL_Surface *get_Picture( std::string name );
+
+	// Waits until the Sound is converted for the Mixer. Returns NULL
+	// if the Loader doesn't load it or failed. Free the Sample with free().
+	Uint8 *get_Audio( std::string name, Uint32 &length );
+
+	// Number of Processors of the Computer
+	static int processors();
+
+private:
+	struct Job {
+		const char *name;
+		bool is_audio,
+			done,
+			taken;
+		SDL_Surface *picture;
+		Uint8 *sample;
+		Uint32 length;
+	};
+
+	std::vector<Job> jobs;
+	int next_job;
+	std::vector<SDL_Thread *> threads;
+	SDL_mutex *lock;
+	SDL_cond *finished;
+
+	Job *wait_for( std::string name, bool is_audio );
+
+	static int work( void *loader );
+};
+
+#endif
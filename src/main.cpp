@@ -34,6 +34,7 @@
 #include <cmath>
 #include <unistd.h>
 #include <time.h>
+#include <stdlib.h>
 
 #include "stdio.h"
 
@@ -46,6 +47,12 @@
 #include "sound.hpp"
 #include "graphics.hpp"
 #include "galaxy.hpp"
+#include "pack.hpp"
+#include "loader.hpp"
+#include "renderlist.hpp"
+#include "jobs.hpp"
+#include "tasks.hpp"
+#include "shotcache.hpp"
 
 #ifdef __ENVIRONMENT__
 #include "envz.h"
@@ -65,6 +72,11 @@ SDL_Surface *MYSDLSCREEN;
 Language language;
 Soundset *sound;
 Font *font;
+Pack *pack = NULL;
+Loader *loader = NULL;
+Jobs *jobs = NULL;
+Tasks *tasks = NULL;
+Shotcache *shotcache = NULL;
 Playfield *pf;
 Uint32 videoflags = 0, 
 	bitplanes = 0,
@@ -107,15 +119,26 @@ class Playfield
 //-----------------------------------------------------------------------------------------
 {
 public:
-	Playfield() 
+	// teams < 2 is every Player for himself, first_seed 0 takes the Time,
+	// the Hint shows hint_levels Paths
+	Playfield( int player_count, int teams, int first_seed, int hint_levels ) 
 	:
 		is_done(false),
+		player_count(player_count),
+		teams(teams),
 		blink(BLINKTIME),
 		winner_is_player(-1),
 		scroller_active(false),
 		hintmode(false),
+		hint(NULL),
+		hint_levels(hint_levels),
+		scroller_x(SCREENWIDTH),
+		galaxy_type(GALAXY_PLANETS),
 		computerstrength(2),
-		show_winner_time(WINNINGWAIT)
+		show_winner_time(WINNINGWAIT),
+		presents(0),
+		present_time(0),
+		present_max(0)
 	{
 		verbose( "Initializing Playfield" ); 
 
@@ -123,11 +146,37 @@ public:
 		goldrain = new Goldrain[MAXGOLDRAIN];
 		shooting_star = new Shootingstar();
 
-		for ( int i=0; i < MAXPLAYER; i++ )
-			players[i] = new Ufo( SCREENWIDTH/2, SCREENHEIGHT/2 );
+		#ifdef __THREADS__
+		renderbuffer = new Renderbuffer();
+		#endif
+
+		// Even Players on the left Side, odd Players on the right. Too
+		// many Saucers for one Column stand in two, one Place apart.
+		for ( int i=0; i < player_count; i++ ) {
+			int on_side = ( player_count - i%2 + 1 ) / 2,
+				place = i/2,
+				columns = ( on_side > MAXUFOSINCOLUMN ) ? 2 : 1;
+			double step = (double)SCREENHEIGHT / ( on_side + 1 ),
+				border = BORDERWIDTH + ( place % columns ) * UFOCOLUMNGAP,
+				y = step * ( place + 1 );
+
+			players[i] = new Ufo( ( i%2 == 0 ) ? border : SCREENWIDTH-border, y );
+
+			// Each Saucer keeps half its Height away from the Middle
+			// between it and its Neighbours in the Column
+			double reach = step * columns / 2 - UFOHEIGHT/2;
 
-		galaxy = new Galaxy( planets=(int)RANDOM(MAXPLANETS,MINPLANETS), seed = time(NULL) );
-		galaxy->set_Ufos( players, MAXPLAYER );
+			players[i]->set_Slot( 
+				( place < columns ) ? BORDERWIDTH : y - reach,
+				( place+columns >= on_side ) ? SCREENHEIGHT-BORDERWIDTH : y + reach );
+
+			if ( teams >= 2 )
+				players[i]->set_Team( i % teams );
+		}
+
+		galaxy = new Galaxy( planets=(int)RANDOM(MAXPLANETS,MINPLANETS), seed = ( first_seed > 0 ) ? first_seed : time(NULL) );
+		galaxy->set_Ufos( players, player_count );
+		prepare_Galaxy();
 	}
 	
 	~Playfield()
@@ -138,9 +187,14 @@ public:
 		delete[] goldrain;
 		delete shooting_star;
 
-		for ( int i=0; i < MAXPLAYER; i++ ) delete players[i];
+		for ( int i=0; i < player_count; i++ ) delete players[i];
 
+		delete hint;
 		delete galaxy;
+
+		#ifdef __THREADS__
+		delete renderbuffer;
+		#endif
 	}
 
 	bool is_Done() 
@@ -149,18 +203,66 @@ public:
 	}
 	
 	#ifdef __THREADS__
-	static int gameLogicThread( void* )  
+	// Draws the latest Frame play() has recorded, while play() goes
+	// on with the next one
+	static int renderThread( void* )  
 	{
-		Gametimer timer = Gametimer(TICK_INTERVAL_SCREEN);
-
 		while ( !pf->is_Done() ) {
-		 	pf->draw();
-			timer.delay();
+			Renderlist *frame = pf->renderbuffer->get_Front( 100 );
+
+			if ( frame != NULL ) {
+				pf->renderbuffer->lock();
+				frame->show();
+				pf->present();
+				pf->renderbuffer->unlock();
+			}
 		}
 		
 		return 0;
 	}
 	#endif
+
+	// With Threads the Frame is only recorded here and drawn by the
+	// renderThread
+	void show_Frame()
+	{
+		#ifdef __THREADS__
+		Renderlist::start_Recording( renderbuffer->get_Back() );
+		draw();
+		Renderlist::stop_Recording();
+		renderbuffer->publish();
+		#else
+		draw();
+		present();
+		#endif
+	}
+
+	// Flips the Screen and counts how long that blocks. Without
+	// Threads the Game waits that long, with Threads only the
+	// renderThread does.
+	void present()
+	{
+		Uint32 start = SDL_GetTicks();
+
+		SDL_Flip(MYSDLSCREEN);
+
+		Uint32 blocked = SDL_GetTicks() - start;
+
+		present_time += blocked;
+
+		if ( blocked > present_max )
+			present_max = blocked;
+
+		if ( ++presents == PRESENTREPORT ) {
+			std::ostringstream info;
+			info << "Flip blocked " << (double)present_time / presents 
+				<< " ms (max. " << present_max << " ms) in the last " 
+				<< presents << " Frames";
+			verbose( info.str() );
+
+			presents = present_time = present_max = 0;
+		}
+	}
 	
 	void draw()
 	{
@@ -168,23 +270,28 @@ public:
 		
 		galaxy->draw();
 
-		// Draw Fullpower-Hint
-		if ( hintmode )	
-			players[active_player]->draw_hint( galaxy );
+		// Draw Fullpower-Hint, its Thread starts when it is first shown
+		if ( hintmode )	{
+
+			if ( hint == NULL )
+				hint = new Hintpreview( galaxy, galaxy->get_ShootWidth( WEAPON_LASER ), hint_levels );
+
+			players[active_player]->draw_hint( hint );
+		}
 
 		// If we have a winner -> draw Goldrain above Flying Saucer
 		if ( winner_is_player != -1 ) {
 			int xx = (int)( players[winner_is_player]->get_X() );
 			int yy = (int)( players[winner_is_player]->get_Y() )-100;
 			
-			SDL_LockSurface( MYSDLSCREEN );
+			Sprite::lockScreen();
 			
 			for ( int i=0; i < MAXGOLDRAIN; i++ ) {		
 				goldrain[i].setOffset(xx, yy);
 				goldrain[i].draw();
 			}
 			
-			SDL_UnlockSurface( MYSDLSCREEN );
+			Sprite::unlockScreen();
 		}
 
 		// Draw the Screentext
@@ -193,18 +300,16 @@ public:
 		// Draw Helpscroller
 		if (scroller_active)
 			draw_Scroller();
-
-		SDL_Flip(MYSDLSCREEN);	
 	}
 	
 	void play() 
 	{
 		verbose( "Starting Gameloop" ); 
 
-		Gametimer timer = Gametimer(TICK_INTERVAL_GAME);
+		Gametimer timer = Gametimer(TICK_INTERVAL_SCREEN);
+		Uint32 last_time = SDL_GetTicks(), lag = 0;
 
-		bool p_mode[] = {false,false};
-		init_Game( p_mode );
+		init_Game( 0 );
 
 		bool targeting = false,
 			targetlocked = false,
@@ -212,10 +317,12 @@ public:
 		SDL_Event event;
 
 		#ifdef __THREADS__
-		SDL_Thread *t = SDL_CreateThread( Playfield::gameLogicThread, NULL );
+		SDL_Thread *t = SDL_CreateThread( Playfield::renderThread, NULL );
 		#endif
 
 		SDL_EnableUNICODE(1);
+
+		bool first_frame = true;
 		
 		do {		
 			while ( SDL_PollEvent(&event) ) {
@@ -230,7 +337,7 @@ public:
 						keypressed = false;		// ???
 						
 						if ( targeting ) {
-							galaxy->set_Shoot( players[active_player]->shoot() );
+							players[active_player]->shoot( galaxy );
 							targeting = false;
 							targetlocked = true;
 						}
@@ -240,24 +347,21 @@ public:
 					case SDL_KEYDOWN:
 		
 						if( event.key.keysym.unicode == UKEY_ONEPLAYER ) {
-							bool p_mode[] = {true,false};
-							init_Game( p_mode );
+							init_Game( 1 );
 							targetlocked = false;
 							targeting = false;
 							sound->play(SOUND_NEWGAME);
 						}
 			
 						if( event.key.keysym.unicode == UKEY_TWOPLAYER ) {
-							bool p_mode[] = {true,true};
-							init_Game( p_mode );
+							init_Game( player_count );
 							targetlocked = false;
 							targeting = false;
 							sound->play(SOUND_NEWGAME);
 						}
 		
 						if( event.key.keysym.unicode == UKEY_DEMO ) {
-							bool p_mode[] = {false,false};
-							init_Game( p_mode );
+							init_Game( 0 );
 							targetlocked = false;
 							targeting = false;
 						}
@@ -284,11 +388,19 @@ public:
 					keypressed = true;
 					bitplanes = 16-bitplanes;
 					fullscreen = SDL_FULLSCREEN-fullscreen;
+
+					#ifdef __THREADS__
+					renderbuffer->lock();
+					#endif
 					
 					if ( ( MYSDLSCREEN = SDL_SetVideoMode( SCREENWIDTH, SCREENHEIGHT, bitplanes, videoflags | fullscreen ) ) == NULL ) {
 						std::cout << "Can't set video mode: " << SDL_GetError() << std::endl;
 						exit(1);
 					}
+
+					#ifdef __THREADS__
+					renderbuffer->unlock();
+					#endif
 				}
 
 				#ifdef __TRAINERMODE__
@@ -303,7 +415,7 @@ public:
 					scroller_active = !scroller_active;
 				
 					if (scroller_active)
-						draw_Scroller(true);					
+						scroller_x = SCREENWIDTH;
 				}
 
 				if( keys[KEY_TOGGLELANGUAGE] ) {
@@ -316,15 +428,24 @@ public:
 					keypressed=true;
 
 					init_Galaxy();
-						
-					int p, s;
-					
-					if ( galaxy->create(
-						p = (int)RANDOM(MAXPLANETS, MINPLANETS),
-						s = time(NULL) ) ) {
-						planets = p;
-						seed = s;
-					}					
+				}
+
+				if( !galaxy->is_ShootActive() && keys[KEY_TOGGLEGALAXYTYPE] ) {
+					keypressed=true;
+
+					switch ( galaxy_type ) {
+						case GALAXY_PLANETS:
+							galaxy_type = GALAXY_ASTEROIDS;
+							break;
+						case GALAXY_ASTEROIDS:
+							galaxy_type = GALAXY_ORBITS;
+							break;
+						default:
+							galaxy_type = GALAXY_PLANETS;
+					}
+
+					prepare_Galaxy();
+					init_Galaxy();
 				}
 
 				if( keys[KEY_TOGGLESOUND] ) {
@@ -333,80 +454,120 @@ public:
 				}
 			}
 
-			// Diese Tasten sind gesperrt sofern der Schuss abgefeuert wurde
-			// oder es einen Gewinner gibt!
-			if ( winner_is_player == -1 ) {
+			// The Game goes on in Steps of TICK_INTERVAL_GAME, however
+			// fast the Frames are drawn. Fast-Forward makes more Steps.
+			Uint32 now = SDL_GetTicks();
+			int steps;
+
+			lag += now - last_time;
+			last_time = now;
+			steps = lag / TICK_INTERVAL_GAME;
+			lag %= TICK_INTERVAL_GAME;
+
+			if ( steps > MAXCATCHUP )
+				steps = MAXCATCHUP;
 
-				if ( players[active_player]->is_Computer() ) {
+			if ( keys[KEY_FASTFORWARD] )
+				steps *= FASTFORWARD;
+
+			for ( int step=0; step < steps; step++ ) {
+
+				Sprite::next_Tick();
+				galaxy->keep_Positions();
+
+				// Diese Tasten sind gesperrt sofern der Schuss abgefeuert wurde
+				// oder es einen Gewinner gibt!
+				if ( winner_is_player == -1 ) {
 					static int computer_strength[] = { 10, 8, 6, 3, 1 };
-					players[active_player]->calculate_Computer_Move( galaxy, computer_strength[computerstrength] );			
-				} else {
+
+					// Computers think ahead while the others aim and
+					// while Shoots fly
+					for ( int i=0; i < player_count; i++ )
+						if ( players[i]->is_Computer() && !players[i]->is_dead()
+							&& ( i != active_player || galaxy->is_ShootActive() ) )
+							players[i]->ponder( galaxy, computer_strength[computerstrength] );
+
+					if ( players[active_player]->is_Computer() ) {
+						players[active_player]->calculate_Computer_Move( galaxy, computer_strength[computerstrength] );			
+					} else {
 					
-					if ( !targetlocked ) {
+						if ( !targetlocked ) {
 			
-						#ifdef __TRAINERMODE__
-						if ( keys[KEY_NEXTWEAPON] && !keypressed ) {
-							players[active_player]->next_Weapon();
-							keypressed = true;
-						}
-						#endif
-
-						if ( keys[KEY_CHOOSEBONUS] && !keypressed ) {
-							players[active_player]->buy_Bonus();
-							keypressed = true;
-						}
+							#ifdef __TRAINERMODE__
+							if ( keys[KEY_NEXTWEAPON] && !keypressed ) {
+								players[active_player]->next_Weapon();
+								keypressed = true;
+							}
+							#endif
+
+							if ( keys[KEY_CHOOSEBONUS] && !keypressed ) {
+								players[active_player]->buy_Bonus();
+								keypressed = true;
+							}
 		
-						if( keys[KEY_DECSHOOT] ) {
-							players[active_player]->dec_ShootAngle();
-						}
+							if( keys[KEY_DECSHOOT] ) {
+								players[active_player]->dec_ShootAngle();
+							}
 			
-						if( keys[KEY_INCSHOOT] ) {
-							players[active_player]->inc_ShootAngle();
-						}
+							if( keys[KEY_INCSHOOT] ) {
+								players[active_player]->inc_ShootAngle();
+							}
 			
-						if( keys[KEY_MOVEUP] ) {
-							players[active_player]->move_Up();
-						}
+							if( keys[KEY_MOVEUP] ) {
+								players[active_player]->move_Up();
+							}
 						
-						if( keys[KEY_MOVEDOWN] ) {
-							players[active_player]->move_Down();
-						}
+							if( keys[KEY_MOVEDOWN] ) {
+								players[active_player]->move_Down();
+							}
 						
-						if( keys[KEY_FIRE] ) {
-							players[active_player]->inc_ShootPower();
-							targeting = true;
+							if( keys[KEY_FIRE] ) {
+								players[active_player]->inc_ShootPower();
+								targeting = true;
+							}
 						}
 					}
-				}
-			} else {
+				} else {
 
-				if ( --show_winner_time == 0 ) {
-					init_Game();
+					if ( --show_winner_time == 0 ) {
+						init_Game();
+					}
+				} 
+
+
+				// Animate the Shoots in Galaxy. Animate() returns true
+				// if Shoot is finished.
+				if ( galaxy->animate() ) {
+					next_Player();
+					targetlocked = false;
+					targeting = false;
+				} 
+				else if ( galaxy->has_Extra_collision() ) {
+					players[active_player]->add_Bonus();
 				}
-			} 
-
-
-			// Animate the Shoots in Galaxy. Animate() returns true
-			// if Shoot is finished.
-			if ( galaxy->animate() ) {
-				next_Player();
-				targetlocked = false;
-				targeting = false;
-			} 
-			else if ( galaxy->has_Extra_collision() ) {
-				players[active_player]->add_Bonus();
-			}
 			
-			// Scrolling only depends on x, y-Offsets for Sprites
-			set_Scrolling();
+				// Scrolling only depends on x, y-Offsets for Sprites
+				set_Scrolling();
+
+				if ( ( winner_is_player = check_for_Winner() ) >= 0
+					&& show_winner_time == WINNINGWAIT ) 
+					sound->play(SOUND_WINNINGGAME);
+			}
 
-			if ( ( winner_is_player = check_for_Winner() ) >= 0
-				&& show_winner_time == WINNINGWAIT ) 
-				sound->play(SOUND_WINNINGGAME);
+			// Long Work goes on until the Budget of the Frame is spent
+			tasks->run();
 
-			#ifndef __THREADS__
-			draw();
-			#endif
+			// Draw between the last and the next Step
+			Spaceobject::set_Blend( (double)lag / TICK_INTERVAL_GAME );
+
+			show_Frame();
+
+			if ( first_frame ) {
+				std::ostringstream info;
+				info << "First Frame after " << SDL_GetTicks() << " ms";
+				verbose( info.str() );
+				first_frame = false;
+			}
 			
 			if( keys[KEY_SCREENSHOT] && !keypressed ) {
 				static int screenshotid = 0;
@@ -417,7 +578,13 @@ public:
 				char filename[] = "screenshot__.bmp";
 				filename[11] = (char)(screenshotid+96);
 
+				#ifdef __THREADS__
+				renderbuffer->lock();
 				SDL_SaveBMP(MYSDLSCREEN, filename );
+				renderbuffer->unlock();
+				#else
+				SDL_SaveBMP(MYSDLSCREEN, filename );
+				#endif
 
 				keypressed = true;
 			}
@@ -434,6 +601,8 @@ public:
 	
 private:
 	bool is_done;
+	int player_count;
+	int teams;
 	int blink;
 	int active_player, winner_is_player;
 	Star *stars;
@@ -442,10 +611,21 @@ private:
 	Ufo *players[MAXPLAYER];
 	Galaxy *galaxy;
 	bool scroller_active, hintmode;
+	Hintpreview *hint;
+	int hint_levels;
+	int scroller_x;
 	int seed;
 	int planets;
+	int next_seed;
+	int next_planets;
+	Galaxytype galaxy_type;
 	int computerstrength;
 	int show_winner_time;
+	Uint32 presents, present_time, present_max;
+
+	#ifdef __THREADS__
+	Renderbuffer *renderbuffer;
+	#endif
 	
 	void set_Scrolling()
 	{
@@ -482,16 +662,16 @@ private:
 
 	void draw_Background()
 	{
-		SDL_FillRect( MYSDLSCREEN, NULL, SDL_MapRGB( MYSDLSCREEN->format, 0, 0, 30 ));
+		Sprite::fillScreen( SDL_MapRGB( MYSDLSCREEN->format, 0, 0, 30 ) );
 		
-		SDL_LockSurface( MYSDLSCREEN );
+		Sprite::lockScreen();
  
 		for ( int i=0; i < MAXSTARS; i++ )
 			stars[i].draw();
 
 		shooting_star->draw();
 
-		SDL_UnlockSurface( MYSDLSCREEN );		
+		Sprite::unlockScreen();		
 	}	
 	
 	void draw_Text() 
@@ -499,12 +679,30 @@ private:
 		// Game-Display
 		bool blinkon = ( blink < BLINKTIME*2/3 ) ? true : false;
 
+		// Blinking and Shield Amounts go on once per Step of the Game
+		static Uint32 last_tick = 0;
+		bool next = ( last_tick != Sprite::tick );
+
+		last_tick = Sprite::tick;
+
 		// Display Computer/Player-Text, incl. Energy
-		static int old_scores[MAXPLAYER] = { 0, 0 };
+		static int old_scores[MAXPLAYER] = { 0 };
+
+		// Each Side has a Column of Displays, one below the other. Many
+		// Players move them closer together, so all fit on the Screen.
+		int rows = ( player_count+1 ) / 2,
+			spacing = ( SCREENHEIGHT - font->getLineHeight() ) / rows;
+
+		if ( spacing > 4 * font->getLineHeight() )
+			spacing = 4 * font->getLineHeight();
 
-		for ( int i=0; i < MAXPLAYER; i++ ) {
-			int a = 255, x_pos, y_pos;
-			int pl = (int)players[i]->get_Y()+Sprite::y_offset;
+		for ( int i=0; i < player_count; i++ ) {
+			int a = 255;
+
+			int row = i/2,
+				x_pos = ( i%2 == 0 ) ? 35 : SCREENWIDTH-280,
+				y_pos = font->getLineHeight() + row * spacing;
+			int pl = (int)players[i]->get_Y()+Sprite::y_offset - row * spacing;
 
 			if ( pl < 150 && pl > 150-90 )
 				a = (int)pl*2-65;
@@ -512,17 +710,6 @@ private:
 			if ( pl <= 150-90 && pl >= 50-90 )
 				a = (int)110-pl*2+65;
 			
-			switch (i) {
-			
-				case 1:
-					x_pos = SCREENWIDTH-280;
-					y_pos = font->getLineHeight();
-					break;
-				default:
-					x_pos = 35;
-					y_pos = font->getLineHeight();
-			}
-			
 			// Display Computer/Player-Text
 			if ( blinkon || active_player !=i || winner_is_player != -1 ) { 
 		
@@ -533,7 +720,16 @@ private:
 
 			}
 
-			font->print( x_pos, y_pos + font->getLineHeight(), language.getShieldtext( old_scores[i] ), a );
+			std::string shield = language.getShieldtext( old_scores[i] );
+
+			font->print( x_pos, y_pos + font->getLineHeight(), shield, a );
+
+			// The Colours only show the Side, so the Team is behind the Shield
+			if ( teams >= 2 ) {
+				std::ostringstream team;
+				team << "(" << players[i]->get_Team()+1 << ")";
+				font->print( x_pos + font->getWidth( shield + " " ), y_pos + font->getLineHeight(), team.str(), a );
+			}
 
 			// Bonus:
 			static Sprite b_s[] = {
@@ -556,16 +752,21 @@ private:
 			}
 
 			// Shield Amount becomes new Value slowly
-			if ( old_scores[i] < players[i]->get_Energy() )
+			if ( next && old_scores[i] < players[i]->get_Energy() )
 				old_scores[i]++;
 
-			if ( old_scores[i] > players[i]->get_Energy() ) 
+			if ( next && old_scores[i] > players[i]->get_Energy() ) 
 				old_scores[i]--;
 
 		}
 		
+		bool demo = true;
+
+		for ( int i=0; i < player_count; i++ )
+			demo = demo && players[i]->is_Computer();
+
 		// if Computer vs. Computer->Titletext
-		if ( players[0]->is_Computer() && players[1]->is_Computer() ) {
+		if ( demo ) {
 			int yy = SCREENHEIGHT/2 - font->getLineHeight() * _TITLETEXT/2;	
 
 			for ( int i=0; i < _TITLETEXT; i++ ) {	
@@ -593,54 +794,55 @@ private:
 			font->print( (SCREENWIDTH-font->getWidth(ss))/2, font->getLineHeight() + font->getLineHeight(), ss);
 		}		
 
-		if ( --blink < 0 ) 
+		if ( next && --blink < 0 ) 
 			blink = BLINKTIME;		
 	}
 	
-	void draw_Scroller( bool reset = false )
+	void draw_Scroller()
 	{
-		static int x = SCREENWIDTH;
-		
-		if (reset) x = SCREENWIDTH;
+		static Uint32 last_tick = 0;
 		
 		std::string scrollstr = language.getScrollertext();
 		int w = font->getWidth(scrollstr);
 		
-		if ( (x -= SCROLLERSPEED) < -w ) x = SCREENWIDTH;
+		if ( last_tick != Sprite::tick && (scroller_x -= SCROLLERSPEED) < -w ) scroller_x = SCREENWIDTH;
+
+		last_tick = Sprite::tick;
 		
-		font->print( x, SCREENHEIGHT-45, scrollstr);
+		font->print( scroller_x, SCREENHEIGHT-45, scrollstr);
 	}
 
+	// The first living Player of the last Team standing
 	int check_for_Winner() 
 	{
-		int last_man_standing = 0;
-		int dead_men_laying = 0;
-		int winner = -1;
+		int last_man_standing = -1;
 		
-		for ( int i=0; i < MAXPLAYER; i++ ) {
+		for ( int i=0; i < player_count; i++ ) {
+
 			if ( players[i]->is_dead() )
-				dead_men_laying++;
-			else 
+				continue;
+
+			if ( last_man_standing == -1 )
 				last_man_standing = i;
+			else if ( players[i]->get_Team() != players[last_man_standing]->get_Team() )
+				return -1;
 		}
 		
-		if ( dead_men_laying == MAXPLAYER-1 ) {
-			winner = last_man_standing;
-		}
-		
-		return winner;
+		return last_man_standing;
 	}
 
-	void init_Game( bool *player_mode = NULL )
+	// The first humans Players are Humans, the others Computers.
+	// humans = -1 keeps them.
+	void init_Game( int humans = -1 )
 	{
 		verbose ( "Initializing Game" );
 		
 		galaxy->kill_all_Shoots();
 		
-		for ( int i=0; i < MAXPLAYER; i++ ) {
+		for ( int i=0; i < player_count; i++ ) {
 		
-			if ( player_mode != NULL ) {
-				if ( !player_mode[i] )
+			if ( humans >= 0 ) {
+				if ( i >= humans )
 					players[i]->set_Computer();
 				else 
 					players[i]->set_Human();
@@ -661,23 +863,44 @@ private:
  	
 	void init_Galaxy()
 	{
-		int s = time(NULL);
-		int p;
-		
-		if ( galaxy->create( p = (int)RANDOM( MAXPLANETS, MINPLANETS), s ) ) {
-			seed = s;
-			planets = p;
+		if ( galaxy->create( next_planets, next_seed, galaxy_type ) ) {
+			seed = next_seed;
+			planets = next_planets;
+			prepare_Galaxy();
 		}
 	}
 
+	// The next Galaxy is created in the Background while playing
+	void prepare_Galaxy()
+	{
+		if ( galaxy_type == GALAXY_ASTEROIDS )
+			next_planets = (int)RANDOM( MAXASTEROIDS, MINASTEROIDS );
+		else
+			next_planets = (int)RANDOM( MAXPLANETS, MINPLANETS );
+		// The Seeds come from the World-Stream, so "--seed" plays the
+		// same Galaxies again
+		do
+			next_seed = (int)( Random::world.next() >> 1 );
+		while ( next_seed == 0 || next_seed == seed );
+
+		galaxy->prepare( next_planets, next_seed, galaxy_type );
+	}
+
 	void next_Player()
 	{
 		verbose ( "Next Player" );
 
-		if ( ++active_player >= MAXPLAYER )
-			active_player = 0;
+		// Dead Players are skipped
+		for ( int i=0; i < player_count; i++ ) {
+			
+			if ( ++active_player >= player_count )
+				active_player = 0;
+
+			if ( !players[active_player]->is_dead() )
+				break;
+		}
 
-		for ( int i=0; i < MAXPLAYER; i++ ) {
+		for ( int i=0; i < player_count; i++ ) {
 			players[i]->deactivate();
 		}
 		
@@ -713,7 +936,12 @@ int main( int argc, char *argv[], char *envp[] )
 	const std::string __RED    = "\x1b[31m"; 
 	const std::string __NORMAL = "\x1b[0m"; 
 
-	bool get_video_info = false, param_ok;
+	bool get_video_info = false, make_pack = false, param_ok;
+	int player_count = MINPLAYER, teams = 0;
+	int workers = Loader::processors()-1;
+	int budget = TASKBUDGET;
+	int first_seed = 0;
+	int hint_levels = 1;
 
 	for (int i=1; i < argc; i++) {
 		param_ok = false;
@@ -736,10 +964,10 @@ int main( int argc, char *argv[], char *envp[] )
 				<< std::endl
 				<< "Usage: "
 				<< argv[0]
-				<< " [-h --help|-v --version|-f --fullscreen|--videoinfo|--verbose]" << std::endl
+				<< " [-h --help|-v --version|-f --fullscreen|--videoinfo|--verbose|--makepack|--players N|--teams N|--workers N|--budget MS|--seed N|--finesearch|--hints N]" << std::endl
 				<< __RED
 				<< "[1]      Player vs Computer." << std::endl 
-				<< "[2]      Player vs Player." << std::endl 
+				<< "[2]      Player vs Player (all Players are Humans)." << std::endl 
 				<< "[3]      Computer vs Computer (Demo on Titlescreen)." << std::endl 
 				<< "[UP]     Move Flying Saucer Up." << std::endl 
 				<< "[DOWN]   Move Flying Saucer Down." << std::endl 
@@ -747,7 +975,9 @@ int main( int argc, char *argv[], char *envp[] )
 				<< "[RIGHT]  Increase Shootangle." << std::endl 
 				<< "[RETURN] Use Extras to buy Weapon or Shieldpower." << std::endl
 				<< "[SPACE]  Keep pressed to increase Power. Release for shooting." << std::endl 
-				<< "[TAB]    Changes the Galaxy." << std::endl 
+				<< "[TAB]    Changes the Galaxy." << std::endl
+				<< "[G]      Changes between Planets, Asteroid-Field and Orbits." << std::endl 
+				<< "[X]      Keep pressed to fast-forward the Game." << std::endl 
 				<< "[F1]     Toggle Help-Scroller on/off." << std::endl 
 				<< "[F2]     Toggle Language." << std::endl 
 				<< "[C]      Toggles Computerstrength (Trainee...Insane)." << std::endl 
@@ -782,12 +1012,99 @@ int main( int argc, char *argv[], char *envp[] )
 			param_ok = true;
 		}
 		
+		// Write all Graphics and Sounds into a Pack and Exit
+		if ( arg == (std::string)"--makepack" ) {
+			make_pack = true;
+			param_ok = true;
+		}
+		
+		// Number of Flying Saucers in the Galaxy
+		if ( arg == (std::string)"--players" && i+1 < argc ) {
+			player_count = atoi( argv[++i] );
+
+			if ( player_count < MINPLAYER || player_count > MAXPLAYER ) {
+				std::cout << "Error in Options: --players must be between "
+					<< MINPLAYER << " and " << MAXPLAYER << "." << std::endl;
+				exit(1);
+			}
+
+			param_ok = true;
+		}
+
+		// Number of Teams, 0 is every Player for himself
+		if ( arg == (std::string)"--teams" && i+1 < argc ) {
+			teams = atoi( argv[++i] );
+			param_ok = true;
+		}
+
+		// Threads that help the Game-Loop, 0 does everything in one Thread
+		if ( arg == (std::string)"--workers" && i+1 < argc ) {
+			workers = atoi( argv[++i] );
+
+			if ( workers < 0 || workers > MAXWORKERS ) {
+				std::cout << "Error in Options: --workers must be between 0 and "
+					<< MAXWORKERS << "." << std::endl;
+				exit(1);
+			}
+
+			param_ok = true;
+		}
+
+		// ms per Frame for long Work like the Search of the Computer
+		if ( arg == (std::string)"--budget" && i+1 < argc ) {
+			budget = atoi( argv[++i] );
+
+			if ( budget < 0 || budget > MAXTASKBUDGET ) {
+				std::cout << "Error in Options: --budget must be between 0 and "
+					<< MAXTASKBUDGET << "." << std::endl;
+				exit(1);
+			}
+
+			param_ok = true;
+		}
+
+		// Paths the Hint shows, from full Power down
+		if ( arg == (std::string)"--hints" && i+1 < argc ) {
+			hint_levels = atoi( argv[++i] );
+
+			if ( hint_levels < 1 || hint_levels > MAXHINTS ) {
+				std::cout << "Error in Options: --hints must be between 1 and "
+					<< MAXHINTS << "." << std::endl;
+				exit(1);
+			}
+
+			param_ok = true;
+		}
+
+		// The Computer calculates every Shoot in full
+		if ( arg == (std::string)"--finesearch" ) {
+			Shootsearch::set_Coarse( false );
+			param_ok = true;
+		}
+
+		// The first Galaxy, so a Game can be played again
+		if ( arg == (std::string)"--seed" && i+1 < argc ) {
+			first_seed = atoi( argv[++i] );
+
+			if ( first_seed <= 0 ) {
+				std::cout << "Error in Options: --seed must be greater than 0." << std::endl;
+				exit(1);
+			}
+
+			param_ok = true;
+		}
+		
 		if ( !param_ok ) {
 			std::cout << arg << ": Unknown option." << std::endl;
 			exit(1);
 		}
 	}
-	
+
+	if ( teams < 0 || teams == 1 || teams > player_count ) {
+		std::cout << "Error in Options: --teams must be 0 or between 2 and the Number of Players." << std::endl;
+		exit(1);
+	}
+
 	#ifdef __THREADS__
     	if( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_EVENTTHREAD | SDL_INIT_AUDIO ) == -1 ) {
 	#else	
@@ -799,6 +1116,10 @@ int main( int argc, char *argv[], char *envp[] )
 	
  	atexit(SDL_Quit); 
 
+	// Locks for the Threads of the Loader, Jobs and Hint
+	Sprite::init();
+	Mask::init();
+
 	const SDL_VideoInfo *video_Info = SDL_GetVideoInfo();
 
 	if (get_video_info) {
@@ -851,17 +1172,44 @@ int main( int argc, char *argv[], char *envp[] )
     	SDL_WM_SetCaption( language.getWindowtext(), NULL );
 	SDL_ShowCursor(SDL_DISABLE);
 
+	// The Pack is written in the Format of the actual Display
+	if ( make_pack ) 
+		exit( Pack::write( PACKFILE ) ? 0 : 1 );
+
+	pack = new Pack( PACKFILE );
+
+	// Decode all Graphics and Sounds in the Background. Sprites and
+	// the Soundset take them when they need them.
+	Uint32 loading_time = SDL_GetTicks();
+	loader = new Loader();
+
 	sound = new Soundset();
 	font = new Font();
 
-	srand(time(NULL));
+	Random::seed_All( ( first_seed > 0 ) ? first_seed : time(NULL) );
+
+	jobs = new Jobs( ( workers < MAXWORKERS ) ? workers : MAXWORKERS );
+	tasks = new Tasks( budget );
+	shotcache = new Shotcache( SHOTCACHEFILE );
 	
-	pf = new Playfield();
+	pf = new Playfield( player_count, teams, first_seed, hint_levels );
+
+	std::ostringstream info;
+	info << "Loading took " << SDL_GetTicks()-loading_time << " ms";
+	verbose( info.str() );
 
 	pf->play();
 
 	delete pf;
+	delete shotcache;
+	delete tasks;
+	delete jobs;
 	delete font;
+	delete loader;
+
+	// The Mixer plays Samples of the Pack until the Soundset is closed
+	delete sound;
+	delete pack;
 
 	verbose( "Bye..." );
 	
@@ -0,0 +1,179 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "mask.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <cmath>
+#include <map>
+#include <string>
+
+#include <SDL/SDL_thread.h>
+
+#include "graphics.hpp"
+#include "mask.hpp"
+
+// All Masks, like the loaded Pictures in Sprite
+static std::map<std::string, Mask *> masks;
+static SDL_mutex *masks_lock = NULL;
+
+static inline int bitcount( Uint64 word )
+{
+	#ifdef __GNUC__
+	return __builtin_popcountll( word );
+	#else
+	int count = 0;
+
+	for ( ; word != 0; count++ )
+		word &= word-1;
+
+	return count;
+	#endif
+}
+
+static Uint32 getpixel( SDL_Surface *surface, int x, int y )
+{
+	int bpp = surface->format->BytesPerPixel;
+	Uint8 *p = (Uint8 *)surface->pixels + y * surface->pitch + x * bpp;
+
+	switch ( bpp ) {
+		case 1:
+			return *p;
+		case 2:
+			return *(Uint16 *)p;
+		case 3:
+			if ( SDL_BYTEORDER == SDL_BIG_ENDIAN )
+				return p[0] << 16 | p[1] << 8 | p[2];
+			else
+				return p[0] | p[1] << 8 | p[2] << 16;
+		default:
+			return *(Uint32 *)p;
+	}
+}
+
+/******************************************************************************************
+ *
+ * Mask
+ *
+ ******************************************************************************************/
+Mask::Mask( SDL_Surface *surface )
+:
+	width(surface->w),
+	height(surface->h),
+	words((surface->w+63)/64),
+	center_x(surface->w/2),
+	center_y(surface->w/2)		// Sprites are square (see Sprite::draw())
+{
+	Uint32 colorkey = surface->format->colorkey;
+
+	bits.assign( words * height, 0 );
+
+	SDL_LockSurface( surface );
+
+	for ( int y=0; y < height; y++ )
+		for ( int x=0; x < width; x++ )
+			if ( getpixel( surface, x, y ) != colorkey )
+				bits[ y*words + x/64 ] |= (Uint64)1 << ( x%64 );
+
+	SDL_UnlockSurface( surface );
+}
+
+void Mask::init()
+{
+	masks_lock = SDL_CreateMutex();
+}
+
+const Mask *Mask::get( const char *filename )
+{
+	SDL_LockMutex( masks_lock );
+
+	std::map<std::string, Mask *>::iterator i = masks.find( filename );
+	Mask *mask;
+
+	if ( i != masks.end() ) {
+		mask = i->second;
+	} else {
+		verbose( "Initializing Mask: " + std::string(filename) );
+
+		SDL_Surface *surface = Sprite::load( filename );
+		mask = new Mask( surface );
+		Sprite::release( surface );
+
+		masks[filename] = mask;
+	}
+
+	SDL_UnlockMutex( masks_lock );
+
+	return mask;
+}
+
+int Mask::overlap( double x, double y, double radius ) const
+{
+	int count = 0;
+	double radius2 = radius*radius;
+
+	// Pixel px, py has its Center at px+0.5-center_x, py+0.5-center_y
+	int row_1 = (int)floor( y - radius + center_y ),
+		row_2 = (int)ceil( y + radius + center_y );
+
+	if ( row_1 < 0 ) 
+		row_1 = 0;
+
+	if ( row_2 > height-1 )
+		row_2 = height-1;
+
+	for ( int row = row_1; row <= row_2; row++ ) {
+		double dy = row + 0.5 - center_y - y;
+
+		if ( dy*dy > radius2 )
+			continue;
+
+		double half = sqrt( radius2 - dy*dy );
+		int col_1 = (int)ceil( x - half + center_x - 0.5 ),
+			col_2 = (int)floor( x + half + center_x - 0.5 );
+
+		if ( col_1 < 0 )
+			col_1 = 0;
+
+		if ( col_2 > width-1 )
+			col_2 = width-1;
+
+		if ( col_1 > col_2 )
+			continue;
+
+		const Uint64 *line = &bits[ row*words ];
+
+		for ( int w = col_1/64; w <= col_2/64; w++ ) {
+			Uint64 m = ~(Uint64)0;
+
+			if ( w == col_1/64 )
+				m &= ~(Uint64)0 << ( col_1%64 );
+
+			if ( w == col_2/64 )
+				m &= ~(Uint64)0 >> ( 63 - col_2%64 );
+
+			count += bitcount( line[w] & m );
+		}
+	}
+
+	return count;
+}
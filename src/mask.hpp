@@ -0,0 +1,68 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "mask.hpp"
+ *
+ * Mask - One Bit for each Pixel of a Picture that is not transparent,
+ * 64 Pixels in one Word. It is used for exact Collisions with Planets
+ * and Stones that are not round (Saturn!). A Circle is tested with a
+ * few ANDs and Bitcounts per Row.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __MASK_HPP__
+#define __MASK_HPP__
+
+#include <vector>
+
+#include <SDL/SDL.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Mask
+ *
+ ******************************************************************************************/
+class Mask
+{
+public:
+	// Creates the Lock of all Masks. Call it after SDL_Init().
+	static void init();
+
+	// Each Picture gets only one Mask. The first Call must be made in
+	// the Main-Thread (it loads the Picture), later Calls in any Thread.
+	static const Mask *get( const char *filename );
+
+	// Number of Pixels within the Circle. x and y are relative to the
+	// Center of the Picture (like Sprite::setPos()).
+	int overlap( double x, double y, double radius ) const;
+
+private:
+	int width, height;
+	int words;		// Words per Row
+	int center_x, center_y;
+	std::vector<Uint64> bits;
+
+	Mask( SDL_Surface *surface );
+};
+
+#endif
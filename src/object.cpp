@@ -26,16 +26,21 @@
 #include <cmath>
 
 #include "object.hpp"
+#include "entities.hpp"
 
 /************************************************************************
  *									*
  * Spaceobject								*	
  *									*
  ************************************************************************/
+double Spaceobject::blend = 1;
+
 Spaceobject::Spaceobject( double x, double y )
 :
 	x(x),
 	y(y),
+	keep_x(x),
+	keep_y(y),
 	width(0),
 	weight(0),
 	speed(0),
@@ -92,6 +97,27 @@ double Spaceobject::get_Spacing() const
 	return spacing;
 }
 
+double Spaceobject::get_DrawX() const
+{
+	return keep_x + ( x - keep_x ) * blend;
+}
+
+double Spaceobject::get_DrawY() const
+{
+	return keep_y + ( y - keep_y ) * blend;
+}
+
+void Spaceobject::keep_Position()
+{
+	keep_x = x;
+	keep_y = y;
+}
+
+void Spaceobject::set_Blend( double blend )
+{
+	Spaceobject::blend = ( blend < 0 ) ? 0 : ( blend > 1 ) ? 1 : blend;
+}
+
 bool Spaceobject::has_collision( Spaceobject *object )
 {
 	if ( check_collision( object->get_X(), object->get_Y(), object->get_Width() ) ) {
@@ -104,6 +130,18 @@ bool Spaceobject::has_collision( Spaceobject *object )
 
 bool Spaceobject::check_collision( double x, double y, double width, bool spacing ) { return false; }
 
+void Spaceobject::set_Tick( int tick ) {}
+
+bool Spaceobject::is_Pushed()
+{
+	return false;
+}
+
+void Spaceobject::store( Entities &entities, int owner )
+{
+	entities.add( this, Entities::ENTITY_OTHER, x, y, width, spacing, weight, owner );
+}
+
 void Spaceobject::draw() {}
 
 void Spaceobject::hit( Spaceobject *object ) {}
@@ -117,9 +155,9 @@ bool Spaceobject::check_sphere_collision( double x, double y, double width, bool
 	if ( spacing ) 
 		my_width += this->spacing;
 
-	double dist_Center = sqrt( (x - my_x) * (x - my_x) + ( y - my_y ) * ( y - my_y ) );
+	double dist_Center2 = (x - my_x) * (x - my_x) + ( y - my_y ) * ( y - my_y );
 	double dist_Radius = ( width + my_width )/2;
 
-	return dist_Center <= dist_Radius;	
+	return dist_Radius >= 0 && dist_Center2 <= dist_Radius * dist_Radius;	
 }
 
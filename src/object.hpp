@@ -30,6 +30,8 @@
 #ifndef __OBJECT_HPP__
 #define __OBJECT_HPP__
 
+class Entities;
+
 /************************************************************************
  *									*
  * Spaceobject								*	
@@ -59,6 +61,19 @@ public:
 	double get_Direction() const;
 	
 	double get_Spacing() const;
+
+	// Drawing happens between two Steps of the Game: at the Position
+	// kept before the last Step, blended towards the current one.
+	double get_DrawX() const;
+
+	double get_DrawY() const;
+
+	// Keeps the Position before a Step of the Game. Objects that
+	// consist of more Parts keep them all.
+	virtual void keep_Position();
+
+	// 0 draws all Objects where they were kept, 1 where they are
+	static void set_Blend( double blend );
 	
 	// This is a "real" collision Function. That means
 	// that within this Function the Method hit() is
@@ -69,6 +84,18 @@ public:
 	// Area presented by x, y and width values.
 	// Returns TRUE if there was a collision.
 	virtual bool check_collision( double x, double y, double width, bool spacing=false );
+
+	// Moves Objects with a fixed Path (Stones) to where they are at
+	// that Tick of the Galaxy.
+	virtual void set_Tick( int tick );
+
+	// True while a Hit still pushes the Object away from its Place
+	// or Path. Shoots searched before are out of Date then.
+	virtual bool is_Pushed();
+
+	// Puts Position, Size and Weight into the Entities of the Galaxy.
+	// Objects that consist of more Parts add them all.
+	virtual void store( Entities &entities, int owner=-1 );
 	
 	// Graphical Output on the Screen
 	virtual void draw();
@@ -82,11 +109,14 @@ public:
 
 protected:
 	double x, y;
+	double keep_x, keep_y;
 	double width, weight;
 	double speed, direction;
 	double spacing;
 	bool in_background;
 
+	static double blend;
+
 	bool check_sphere_collision( double x, double y, double width, bool spacing=false );
 };
 
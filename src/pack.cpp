@@ -0,0 +1,341 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "pack.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "graphics.hpp"
+#include "sound.hpp"
+#include "pack.hpp"
+
+const Uint32 PACKVERSION = 1;
+const Uint32 PACKALIGN = 16;		// Pixelrows and Samples start aligned
+
+/******************************************************************************************
+ *
+ * Pack
+ *
+ ******************************************************************************************/
+Pack::Pack( std::string filename )
+:
+	data(NULL),
+	size(0),
+	mapped(false),
+	header(NULL),
+	entries(NULL)
+{
+	verbose( "Initializing Pack: " + filename );
+
+	#ifndef __WIN32__
+	int fd = open( filename.c_str(), O_RDONLY );
+	struct stat info;
+
+	if ( fd < 0 ) {
+		verbose( "No Pack found. Loading single Files." );
+		return;
+	}
+
+	if ( fstat( fd, &info ) == 0 && info.st_size > 0 ) {
+		size = info.st_size;
+
+		// Private and writable: SDL may touch the Pixels of a Surface,
+		// but never the File.
+		void *map = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+
+		if ( map != MAP_FAILED ) {
+			data = (Uint8 *)map;
+			mapped = true;
+		}
+	}
+
+	close( fd );
+	#else
+	FILE *file = fopen( filename.c_str(), "rb" );
+
+	if ( file == NULL ) {
+		verbose( "No Pack found. Loading single Files." );
+		return;
+	}
+
+	fseek( file, 0, SEEK_END );
+	size = ftell( file );
+	fseek( file, 0, SEEK_SET );
+	data = (Uint8 *)malloc( size );
+
+	if ( data != NULL && fread( data, 1, size, file ) != size ) {
+		free( data );
+		data = NULL;
+	}
+
+	fclose( file );
+	#endif
+
+	if ( data != NULL ) {
+		header = (Header *)data;
+		entries = (Entry *)( data + sizeof(Header) );
+	}
+
+	if ( !is_valid() ) {
+		verbose( "Pack doesn't match the Display. Loading single Files." );
+
+		#ifndef __WIN32__
+		if ( mapped )
+			munmap( data, size );
+		#else
+		free( data );
+		#endif
+
+		data = NULL;
+		header = NULL;
+		entries = NULL;
+		mapped = false;
+	}
+}
+
+Pack::~Pack()
+{
+	verbose( "Deleting Pack" );
+
+	if ( data != NULL ) {
+		#ifndef __WIN32__
+		if ( mapped )
+			munmap( data, size );
+		#else
+		free( data );
+		#endif
+	}
+}
+
+bool Pack::is_open() const
+{
+	return data != NULL;
+}
+
+bool Pack::contains( std::string name )
+{
+	return find( name, ENTRY_SURFACE ) != NULL || find( name, ENTRY_AUDIO ) != NULL;
+}
+
+SDL_Surface *Pack::get_Surface( std::string name )
+{
+	Entry *entry = find( name, ENTRY_SURFACE );
+
+	if ( entry == NULL )
+		return NULL;
+
+	SDL_Surface *surface = SDL_CreateRGBSurfaceFrom( data + entry->offset,
+		entry->w, entry->h, header->bpp, entry->pitch,
+		header->rmask, header->gmask, header->bmask, header->amask );
+
+	// Without RLEACCEL: SDL would keep an encoded Copy of each Picture
+	if ( surface != NULL )
+		SDL_SetColorKey( surface, SDL_SRCCOLORKEY, entry->colorkey );
+
+	return surface;
+}
+
+Uint8 *Pack::get_Audio( std::string name, Uint32 &length )
+{
+	Entry *entry = find( name, ENTRY_AUDIO );
+
+	if ( entry == NULL )
+		return NULL;
+
+	length = entry->length;
+
+	return data + entry->offset;
+}
+
+Pack::Entry *Pack::find( std::string name, Entrytype type )
+{
+	if ( data == NULL )
+		return NULL;
+
+	for ( Uint32 i=0; i < header->entries; i++ )
+		if ( entries[i].type == (Uint32)type && name == entries[i].name )
+			return &entries[i];
+
+	return NULL;
+}
+
+bool Pack::is_valid()
+{
+	if ( data == NULL || size < sizeof(Header) )
+		return false;
+
+	Header h = make_Header( MYSDLSCREEN->format, header->entries );
+
+	if ( memcmp( header, &h, sizeof(Header) ) != 0 )
+		return false;
+
+	// All Sizes are compared by Division, so a broken Pack can't wrap them
+	if ( header->entries > ( size - sizeof(Header) ) / sizeof(Entry) )
+		return false;
+
+	Uint32 bytes = ( header->bpp + 7 ) / 8;
+
+	for ( Uint32 i=0; i < header->entries; i++ ) {
+		Entry &entry = entries[i];
+
+		entry.name[31] = 0;
+
+		if ( entry.offset > size || entry.length > size - entry.offset )
+			return false;
+
+		if ( entry.type == ENTRY_SURFACE 
+			&& ( bytes == 0 || entry.w > entry.pitch / bytes 
+				|| ( entry.h > 0 && entry.pitch > entry.length / entry.h ) ) )
+			return false;
+	}
+
+	return true;
+}
+
+Pack::Header Pack::make_Header( SDL_PixelFormat *format, Uint32 entries )
+{
+	Header h;
+
+	memset( &h, 0, sizeof(Header) );
+	memcpy( h.magic, "HMPK", 4 );
+	h.version = PACKVERSION;
+	h.screenfactor = (Uint32)( SCREENFACTOR * 1000 );
+	h.bpp = format->BitsPerPixel;
+	h.rmask = format->Rmask;
+	h.gmask = format->Gmask;
+	h.bmask = format->Bmask;
+	h.amask = format->Amask;
+	h.audio_frequency = AUDIOFREQUENCY;
+	h.audio_channels = AUDIOCHANNELS;
+	h.entries = entries;
+
+	return h;
+}
+
+// Fill up the File to the next aligned Offset
+static Uint32 pad( FILE *file, Uint32 offset )
+{
+	while ( offset % PACKALIGN != 0 ) {
+		fputc( 0, file );
+		offset++;
+	}
+
+	return offset;
+}
+
+bool Pack::write( std::string filename )
+{
+	verbose( "Writing Pack: " + filename );
+
+	if ( MYSDLSCREEN->format->BytesPerPixel < 2 ) {
+		std::cout << "Error in Pack: Display has no Truecolor-Mode." << std::endl;
+		return false;
+	}
+
+	FILE *file = fopen( filename.c_str(), "wb" );
+
+	if ( file == NULL ) {
+		std::cout << "Error in Pack: Can't write " << filename << std::endl;
+		return false;
+	}
+
+	int amount = _GFXNAMES + _SOUNDSETNAMES;
+	Entry *table = new Entry[amount];
+	Header h = make_Header( MYSDLSCREEN->format, amount );
+	Uint32 offset = sizeof(Header) + amount * sizeof(Entry);
+
+	memset( table, 0, amount * sizeof(Entry) );
+
+	// Skip Header and Table. They are written at last.
+	for ( Uint32 i=0; i < offset; i++ )
+		fputc( 0, file );
+
+	offset = pad( file, offset );
+
+	for ( int i=0; i < _GFXNAMES; i++ ) {
+		Entry &entry = table[i];
+		SDL_Surface *surface = Sprite::load( GFXNAMES[i] );
+
+		SDL_LockSurface( surface );
+
+		strncpy( entry.name, GFXNAMES[i], 31 );
+		entry.type = ENTRY_SURFACE;
+		entry.offset = offset;
+		entry.w = surface->w;
+		entry.h = surface->h;
+		entry.pitch = surface->pitch;
+		entry.length = surface->pitch * surface->h;
+		entry.colorkey = surface->format->colorkey;
+
+		fwrite( surface->pixels, 1, entry.length, file );
+
+		SDL_UnlockSurface( surface );
+		Sprite::release( surface );
+
+		offset = pad( file, offset + entry.length );
+	}
+
+	for ( int i=0; i < _SOUNDSETNAMES; i++ ) {
+		Entry &entry = table[_GFXNAMES + i];
+		Uint32 length;
+		Uint8 *sample = Soundset::convert( SOUNDSETNAMES[i], length );
+
+		if ( sample == NULL ) {
+			std::cout << "Error in Pack: " << SDL_GetError() << std::endl;
+			exit(1);
+		}
+
+		strncpy( entry.name, SOUNDSETNAMES[i], 31 );
+		entry.type = ENTRY_AUDIO;
+		entry.offset = offset;
+		entry.length = length;
+
+		fwrite( sample, 1, length, file );
+		free( sample );
+
+		offset = pad( file, offset + entry.length );
+	}
+
+	fseek( file, 0, SEEK_SET );
+	fwrite( &h, sizeof(Header), 1, file );
+	fwrite( table, sizeof(Entry), amount, file );
+
+	bool ok = !ferror( file );
+
+	fclose( file );
+	delete[] table;
+
+	if ( !ok )
+		std::cout << "Error in Pack: Can't write " << filename << std::endl;
+
+	return ok;
+}
@@ -0,0 +1,105 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "pack.hpp"
+ *
+ * Pack - One File that contains all Graphics and Sounds of the
+ * Game. Pictures are stored in the Format of the Display (already
+ * zoomed and colorkeyed), Sounds are stored in the Format of the
+ * Mixer. The Pack is mapped into Memory and Surfaces are created
+ * directly on the mapped Pixels.
+ *
+ * Write a Pack with "ufo --makepack" (or "make pack").
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __PACK_HPP__
+#define __PACK_HPP__
+
+#include <SDL/SDL.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Pack
+ *
+ ******************************************************************************************/
+class Pack
+{
+public:
+	Pack( std::string filename );
+
+	~Pack();
+
+	bool is_open() const;
+
+	bool contains( std::string name );
+
+	// Returns a new Surface on the mapped Pixels or NULL if the
+	// Pack doesn't contain that Picture. Free it with SDL_FreeSurface().
+	SDL_Surface *get_Surface( std::string name );
+
+	// Returns the converted Sample of a Sound or NULL. The Data
+	// belongs to the Pack and must not be freed!
+	Uint8 *get_Audio( std::string name, Uint32 &length );
+
+	// Loads all Graphics and Sounds and writes them into a new Pack.
+	// The Videomode must be set!
+	static bool write( std::string filename );
+
+private:
+	enum Entrytype {
+		ENTRY_SURFACE = 1,
+		ENTRY_AUDIO = 2
+	};
+
+	struct Header {
+		char magic[4];
+		Uint32 version;
+		Uint32 screenfactor;
+		Uint32 bpp, rmask, gmask, bmask, amask;
+		Uint32 audio_frequency, audio_channels;
+		Uint32 entries;
+	};
+
+	struct Entry {
+		char name[32];
+		Uint32 type;
+		Uint32 offset, length;
+		Uint32 w, h, pitch;
+		Uint32 colorkey;
+	};
+
+	Uint8 *data;
+	Uint32 size;
+	bool mapped;
+	Header *header;
+	Entry *entries;
+
+	Entry *find( std::string name, Entrytype type );
+
+	bool is_valid();
+
+	static Header make_Header( SDL_PixelFormat *format, Uint32 entries );
+};
+
+#endif
@@ -0,0 +1,133 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "placement.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <cmath>
+
+#include "placement.hpp"
+
+/******************************************************************************************
+ *
+ * Placement
+ *
+ ******************************************************************************************/
+Placement::Placement( double left, double top, double right, double bottom, double cell_size )
+:
+	left(left),
+	top(top),
+	right(right),
+	bottom(bottom),
+	cell_size(cell_size),
+	max_radius(0)
+{
+	columns = (int)ceil( ( right - left ) / cell_size );
+	rows = (int)ceil( ( bottom - top ) / cell_size );
+
+	if ( columns < 1 ) 
+		columns = 1;
+
+	if ( rows < 1 )
+		rows = 1;
+
+	cells.resize( columns * rows );
+}
+
+void Placement::add( double x, double y, double radius )
+{
+	Disc disc = { x, y, radius };
+
+	cells[ get_Row( y ) * columns + get_Column( x ) ].push_back( discs.size() );
+	discs.push_back( disc );
+
+	if ( radius > max_radius )
+		max_radius = radius;
+}
+
+bool Placement::is_free( double x, double y, double radius ) const
+{
+	// Every Disc that may touch is within this Range of Cells
+	int range = (int)ceil( ( radius + max_radius ) / cell_size );
+	int column = get_Column( x ),
+		row = get_Row( y );
+
+	for ( int r = row-range; r <= row+range; r++ ) {
+
+		if ( r < 0 || r >= rows )
+			continue;
+
+		for ( int c = column-range; c <= column+range; c++ ) {
+
+			if ( c < 0 || c >= columns )
+				continue;
+
+			const std::vector<int> &cell = cells[ r * columns + c ];
+
+			for ( int i=0; i < (int)cell.size(); i++ ) {
+				const Disc &disc = discs[ cell[i] ];
+				double dx = x - disc.x,
+					dy = y - disc.y,
+					distance = radius + disc.radius;
+
+				if ( dx*dx + dy*dy <= distance*distance )
+					return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool Placement::place( double radius, Random *seed, double &x, double &y )
+{
+	for ( int i=0; i < MAXPLACEMENTDARTS; i++ ) {
+		double x_test = RANDOM_R( right, left, seed );
+		double y_test = RANDOM_R( bottom, top, seed );
+
+		if ( is_free( x_test, y_test, radius ) ) {
+			x = x_test;
+			y = y_test;
+			add( x, y, radius );
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Discs outside are kept in the Border-Cells. That is never
+// farther away than their real Cell.
+int Placement::get_Column( double x ) const
+{
+	int column = (int)floor( ( x - left ) / cell_size );
+
+	return ( column < 0 ) ? 0 : ( column >= columns ) ? columns-1 : column;
+}
+
+int Placement::get_Row( double y ) const
+{
+	int row = (int)floor( ( y - top ) / cell_size );
+
+	return ( row < 0 ) ? 0 : ( row >= rows ) ? rows-1 : row;
+}
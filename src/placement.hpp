@@ -0,0 +1,76 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "placement.hpp"
+ *
+ * Placement - Finds free Places for round Objects (Planets, Extras)
+ * by throwing Darts. Placed Objects are kept in a Grid, so a Dart
+ * is only tested against its Neighbours. The Number of Darts per
+ * Object is limited, so a crowded Galaxy never blocks the Game.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __PLACEMENT_HPP__
+#define __PLACEMENT_HPP__
+
+#include <vector>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Placement
+ *
+ ******************************************************************************************/
+class Placement
+{
+public:
+	// Objects are placed within left..right and top..bottom. The Size of
+	// a Cell should be about the Diameter of the largest Object.
+	Placement( double left, double top, double right, double bottom, double cell_size );
+
+	// Adds an Object that is already there.
+	void add( double x, double y, double radius );
+
+	bool is_free( double x, double y, double radius ) const;
+
+	// Throws at most MAXPLACEMENTDARTS Darts. All Randomness comes from
+	// seed, so the same seed gives the same Places. Returns false if no
+	// free Place was hit; otherwise the Object is added at x, y.
+	bool place( double radius, Random *seed, double &x, double &y );
+
+private:
+	struct Disc {
+		double x, y, radius;
+	};
+
+	double left, top, right, bottom;
+	double cell_size, max_radius;
+	int columns, rows;
+	std::vector<Disc> discs;
+	std::vector< std::vector<int> > cells;
+
+	int get_Column( double x ) const;
+
+	int get_Row( double y ) const;
+};
+
+#endif
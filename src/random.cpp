@@ -0,0 +1,90 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "random.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include "random.hpp"
+
+static Uint32 rotate( Uint32 x, int k )
+{
+	return ( x << k ) | ( x >> ( 32-k ) );
+}
+
+/******************************************************************************************
+ *
+ * Random
+ *
+ ******************************************************************************************/
+Random Random::world;
+Random Random::ai( 2 );
+Random Random::effects( 3 );
+
+Random::Random( Uint32 seed )
+{
+	this->seed( seed );
+}
+
+void Random::seed( Uint32 seed )
+{
+	// SplitMix32 spreads the Seed over the whole State, it is never
+	// all Zero
+	for ( int i=0; i < 4; i++ ) {
+		Uint32 z = ( seed += 0x9e3779b9 );
+
+		z = ( z ^ ( z >> 16 ) ) * 0x85ebca6b;
+		z = ( z ^ ( z >> 13 ) ) * 0xc2b2ae35;
+		state[i] = z ^ ( z >> 16 );
+	}
+}
+
+Uint32 Random::next()
+{
+	Uint32 result = rotate( state[1] * 5, 7 ) * 9;
+	Uint32 t = state[1] << 9;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = rotate( state[3], 11 );
+
+	return result;
+}
+
+double Random::get( double max, double min )
+{
+	return ( max-min ) * ( next() / 4294967296.0 ) + min;
+}
+
+Random Random::split()
+{
+	return Random( next() );
+}
+
+void Random::seed_All( Uint32 seed )
+{
+	world.seed( seed );
+	ai.seed( seed ^ 0x5bd1e995 );
+	effects.seed( seed ^ 0x27d4eb2f );
+}
@@ -0,0 +1,67 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "random.hpp"
+ *
+ * Random - A small and fast Generator (xoshiro128**) with its own
+ * State. The Game has three Streams: world for the Galaxies and the
+ * Game, ai for the Computer and effects for Stars, Goldrain and
+ * other Things that are only drawn. Drawing never changes the Game
+ * and each Thread may take its own Generator (see split()).
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __RANDOM_HPP__
+#define __RANDOM_HPP__
+
+#include <SDL/SDL.h>
+
+/******************************************************************************************
+ *
+ * Random
+ *
+ ******************************************************************************************/
+class Random
+{
+public:
+	// The same seed gives the same Numbers
+	Random( Uint32 seed = 1 );
+
+	void seed( Uint32 seed );
+
+	Uint32 next();
+
+	// min <= Number < max, like the RANDOM-Macros
+	double get( double max, double min );
+
+	// A new Generator seeded from this one, for another Thread
+	Random split();
+
+	static Random world, ai, effects;
+
+	// Seeds all three Streams from one Seed
+	static void seed_All( Uint32 seed );
+
+private:
+	Uint32 state[4];
+};
+
+#endif
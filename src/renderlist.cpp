@@ -0,0 +1,228 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "renderlist.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include "graphics.hpp"
+#include "renderlist.hpp"
+
+/******************************************************************************************
+ *
+ * Renderlist
+ *
+ ******************************************************************************************/
+Renderlist *Renderlist::recording = NULL;
+Uint32 Renderlist::recorder = 0;
+
+Renderlist::Renderlist()
+{
+	verbose( "Initializing Renderlist" );
+}
+
+Renderlist::~Renderlist()
+{
+	verbose( "Deleting Renderlist" );
+}
+
+Renderlist *Renderlist::get_Recording()
+{
+	// Only the recording Thread records
+	if ( recording != NULL && SDL_ThreadID() == recorder )
+		return recording;
+
+	return NULL;
+}
+
+void Renderlist::start_Recording( Renderlist *list )
+{
+	recorder = SDL_ThreadID();
+	recording = list;
+}
+
+void Renderlist::stop_Recording()
+{
+	recording = NULL;
+}
+
+void Renderlist::clear()
+{
+	// Keeps the Memory for the next Frame
+	commands.clear();
+}
+
+void Renderlist::blit( SDL_Surface *image, const SDL_Rect &src, const SDL_Rect &dst, int alpha )
+{
+	Command c;
+
+	c.type = COMMAND_BLIT;
+	c.image = image;
+	c.src = src;
+	c.dst = dst;
+	c.value = alpha;
+
+	commands.push_back( c );
+}
+
+void Renderlist::pixel( int x, int y, Uint32 color )
+{
+	Command c;
+
+	c.type = COMMAND_PIXEL;
+	c.image = NULL;
+	c.dst.x = x;
+	c.dst.y = y;
+	c.value = color;
+
+	commands.push_back( c );
+}
+
+void Renderlist::fill( Uint32 color )
+{
+	Command c;
+
+	c.type = COMMAND_FILL;
+	c.image = NULL;
+	c.value = color;
+
+	commands.push_back( c );
+}
+
+void Renderlist::show()
+{
+	bool locked = false;
+
+	for ( int i=0; i < (int)commands.size(); i++ ) {
+		Command &c = commands[i];
+
+		// Pixels one after another share one Lock of the Screen
+		if ( c.type == COMMAND_PIXEL ) {
+
+			if ( !locked ) {
+				SDL_LockSurface( MYSDLSCREEN );
+				locked = true;
+			}
+
+			Sprite::putpixel( c.dst.x, c.dst.y, c.value, MYSDLSCREEN );
+			continue;
+		}
+
+		if ( locked ) {
+			SDL_UnlockSurface( MYSDLSCREEN );
+			locked = false;
+		}
+
+		if ( c.type == COMMAND_FILL )
+			SDL_FillRect( MYSDLSCREEN, NULL, c.value );
+		else {
+			// SDL clips the Destination, so the Command gets a Copy
+			SDL_Rect dst = c.dst;
+
+			SDL_SetAlpha( c.image, SDL_SRCALPHA, c.value );
+			SDL_BlitSurface( c.image, &c.src, MYSDLSCREEN, &dst );
+		}
+	}
+
+	if ( locked )
+		SDL_UnlockSurface( MYSDLSCREEN );
+}
+
+/******************************************************************************************
+ *
+ * Renderbuffer
+ *
+ ******************************************************************************************/
+Renderbuffer::Renderbuffer()
+:
+	back(0),
+	latest(1),
+	front(2),
+	is_new(false)
+{
+	verbose( "Initializing Renderbuffer" );
+
+	swap_lock = SDL_CreateMutex();
+	screen_lock = SDL_CreateMutex();
+	published = SDL_CreateCond();
+}
+
+Renderbuffer::~Renderbuffer()
+{
+	verbose( "Deleting Renderbuffer" );
+
+	SDL_DestroyCond( published );
+	SDL_DestroyMutex( screen_lock );
+	SDL_DestroyMutex( swap_lock );
+}
+
+Renderlist *Renderbuffer::get_Back()
+{
+	// Only the Logic-Thread changes back, so no Lock is needed
+	lists[back].clear();
+
+	return &lists[back];
+}
+
+void Renderbuffer::publish()
+{
+	SDL_LockMutex( swap_lock );
+
+	int t = latest;
+	latest = back;
+	back = t;
+	is_new = true;
+
+	SDL_CondSignal( published );
+	SDL_UnlockMutex( swap_lock );
+}
+
+Renderlist *Renderbuffer::get_Front( Uint32 timeout )
+{
+	Renderlist *list = NULL;
+
+	SDL_LockMutex( swap_lock );
+
+	if ( !is_new )
+		SDL_CondWaitTimeout( published, swap_lock, timeout );
+
+	if ( is_new ) {
+		int t = latest;
+		latest = front;
+		front = t;
+		is_new = false;
+		list = &lists[front];
+	}
+
+	SDL_UnlockMutex( swap_lock );
+
+	return list;
+}
+
+void Renderbuffer::lock()
+{
+	SDL_LockMutex( screen_lock );
+}
+
+void Renderbuffer::unlock()
+{
+	SDL_UnlockMutex( screen_lock );
+}
@@ -0,0 +1,136 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "renderlist.hpp"
+ *
+ * Renderlist - Everything a Frame draws (Sprites, Text and Pixels),
+ * recorded by the Logic-Thread and drawn later by the Render-Thread.
+ * While a Thread records, Sprite, Font and putpixel() don't touch
+ * the Screen.
+ *
+ * Renderbuffer - Three Renderlists: the Logic-Thread records into
+ * one, the Render-Thread draws another and the third is the latest
+ * finished Frame. Neither Thread ever waits for the other.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __RENDERLIST_HPP__
+#define __RENDERLIST_HPP__
+
+#include <vector>
+
+#include <SDL/SDL.h>
+#include <SDL/SDL_thread.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Renderlist
+ *
+ ******************************************************************************************/
+class Renderlist
+{
+public:
+	Renderlist();
+
+	~Renderlist();
+
+	// Returns the List the calling Thread records into or NULL if
+	// it draws directly on the Screen.
+	static Renderlist *get_Recording();
+
+	// All Drawing of the calling Thread goes into the List until
+	// stop_Recording().
+	static void start_Recording( Renderlist *list );
+
+	static void stop_Recording();
+
+	void clear();
+
+	// The Pictures must stay loaded until the List is drawn. Sprites
+	// never free them (see Sprite::load).
+	void blit( SDL_Surface *image, const SDL_Rect &src, const SDL_Rect &dst, int alpha );
+
+	void pixel( int x, int y, Uint32 color );
+
+	void fill( Uint32 color );
+
+	// Draws everything on the Screen. The Caller flips it.
+	void show();
+
+private:
+	enum Commandtype {
+		COMMAND_BLIT = 0,
+		COMMAND_PIXEL = 1,
+		COMMAND_FILL = 2
+	};
+
+	struct Command {
+		Commandtype type;
+		SDL_Surface *image;
+		SDL_Rect src, dst;		// Pixels only use dst.x, dst.y
+		Uint32 value;			// Alpha or Color
+	};
+
+	std::vector<Command> commands;
+
+	static Renderlist *recording;
+	static Uint32 recorder;
+};
+
+/******************************************************************************************
+ *
+ * Renderbuffer
+ *
+ ******************************************************************************************/
+class Renderbuffer
+{
+public:
+	Renderbuffer();
+
+	~Renderbuffer();
+
+	// Logic-Thread: the empty List for the next Frame
+	Renderlist *get_Back();
+
+	// Logic-Thread: the recorded Frame becomes the latest one
+	void publish();
+
+	// Render-Thread: waits up to timeout ms for a Frame that wasn't
+	// drawn yet. Returns NULL if there is none.
+	Renderlist *get_Front( Uint32 timeout );
+
+	// While locked, the Render-Thread doesn't draw. Lock it to
+	// change the Videomode or to read the Screen.
+	void lock();
+
+	void unlock();
+
+private:
+	Renderlist lists[3];
+	int back, latest, front;
+	bool is_new;
+	SDL_mutex *swap_lock, *screen_lock;
+	SDL_cond *published;
+};
+
+#endif
@@ -93,557 +93,617 @@ void Explosion::hit( Spaceobject *object ) {}
 
 /************************************************************************
  *									*
- * Shoot 								*	
+ * Shootpath								*	
  *									*
  ************************************************************************/
-Shoot::Shoot( double x, double y )
+Shootpath::Shootpath( double width )
 :
-	Spaceobject( x, y ),
-	is_exploding(false),
-	moving_time(0),
-	last_shootPos( Vector_2(0,0,K) ),
-	pre_calculated_Steps(0)
+	width(width),
+	steps(0),
+	last_start( Vector_2( 0, 0, K ) ),
+	last_direction( Vector_2( 0, 0, K ) ),
+	last_tick(-1),
+	positions(NULL)
 {
-	verbose( "Initializing Shoot" );
-
-	weight = 1;	
-	explosion = new Explosion();
+	verbose( "Initializing Shootpath" );
 }
 
-Shoot::~Shoot() 
+Shootpath::~Shootpath()
 {
-	verbose( "Deleting Shoot" );
+	verbose( "Deleting Shootpath" );
 
-	delete explosion;
+	delete[] positions;
 }
 
-bool Shoot::is_active() const
+bool Shootpath::will_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy )
 {
-	return false;
-}
+	Approach approaches[MAXPLAYER];
+	int amount = get_Approaches( player_id, start, direction, galaxy, approaches );
 
-bool Shoot::will_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy )
-{
-	calculate_ShootPath( start, direction, galaxy );
-	
-	for ( int i=0; i < pre_calculated_Steps; i++ )
-		if ( galaxy->is_Ufo_In_Area( player_id, pre_calculated_Pos[i].x, pre_calculated_Pos[i].y, factor ) )
+	for ( int i=0; i < amount; i++ )
+		if ( approaches[i].distance <= get_Reach( approaches[i].ufo, factor ) )
 			return true;		
 		
 	return false;
 }
 
-void Shoot::activate( Vector_2 start, Vector_2 vector )
+int Shootpath::get_Approaches( int player_id, Vector_2 start, Vector_2 direction, Galaxy *galaxy, 
+	Approach *approaches )
 {
-	set_Pos( start.getX(), start.getY() );
-	direction = vector.getAngle();
-	speed = vector.getLength();
-	last_shootPos = start;
-	is_exploding = false;
-	moving_time = MAXSHOOTRUN;
+	Ufo *enemies[MAXPLAYER];
+	int amount = galaxy->find_Enemies( player_id, enemies );
 
-	sound->play(SOUND_SHOOT);
-}
+	calculate( start, direction, galaxy );
 
-void Shoot::reset() {}
+	for ( int u=0; u < amount; u++ ) {
+		double ux = enemies[u]->get_X(),
+			uy = enemies[u]->get_Y();
+		double ax = start.getX(),
+			ay = start.getY();
+		double closest = -1;
+		int closest_step = 0;
 
-void Shoot::destroy() {}
+		// Each Segment from the last Step to this one: the Point on it
+		// next to the Saucer, all squared until the End
+		for ( int i=0; i < steps; i++ ) {
+			double dx = positions[i].x - ax,
+				dy = positions[i].y - ay,
+				length2 = dx*dx + dy*dy,
+				t = 0;
 
-bool Shoot::move( Galaxy *galaxy ) { return false; }
+			if ( length2 > 0 ) {
+				t = ( ( ux-ax )*dx + ( uy-ay )*dy ) / length2;
 
-bool Shoot::has_Extra_collision( Extra *extra ) 
-{
-	return false;
+				if ( t < 0 ) t = 0;
+				if ( t > 1 ) t = 1;
+			}
+
+			double cx = ax + t*dx - ux,
+				cy = ay + t*dy - uy,
+				distance2 = cx*cx + cy*cy;
+
+			if ( closest < 0 || distance2 < closest ) {
+				closest = distance2;
+				closest_step = ( t < 0.5 && i > 0 ) ? i-1 : i;
+			}
+
+			ax = positions[i].x;
+			ay = positions[i].y;
+		}
+
+		approaches[u].ufo = enemies[u];
+		approaches[u].distance = sqrt( closest );
+		approaches[u].step = closest_step;
+	}
+
+	return amount;
 }
 
-bool Shoot::check_collision( double x, double y, double width, bool spacing )
+double Shootpath::get_Reach( const Ufo *ufo, double factor )
 {
-	return false;
+	// The same Aim as Galaxy::is_Ufo_In_Area()
+	return ( ufo->get_Width() + 8 * factor ) / 2;
 }
 
-void Shoot::draw() {}
-
-void Shoot::draw_hint( Vector_2 start, Vector_2 direction, Galaxy *galaxy )
+bool Shootpath::might_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy )
 {
-	static int colorpos = 50;
-	
-	if ( (colorpos -= 20) < 50 ) colorpos = 255;
-	
-	calculate_ShootPath( start, direction, galaxy );
-	
-	int c = colorpos;
-	
-	SDL_LockSurface( MYSDLSCREEN );
+	for ( int i=0; i < MAXPRECALC; i += COARSESTEPS ) {
+		galaxy->calculate_coarsePos( start, direction, i+1, COARSESTEPS );
+		double x = start.getX();
+		double y = start.getY();
 
-	for (int i=0; i < pre_calculated_Steps; i++) {
-		Sprite::putpixel( 
-			pre_calculated_Pos[i].x + Sprite::x_offset,
-			pre_calculated_Pos[i].y + Sprite::y_offset,
-			SDL_MapRGB( MYSDLSCREEN->format, c, c, c ) );
+		// The Shoot flies a long Way between two Looks, so the Aim is
+		// wider than in will_be_a_Hit()
+		if ( galaxy->is_Ufo_In_Area( player_id, x, y, factor*COARSEMARGIN ) )
+			return true;
 
-		if ( (c += 30) > 255 ) c = 50;
+		if ( galaxy->check_collision( x, y, width, false, i+COARSESTEPS ) )
+			return false;
 	}
 
-	SDL_UnlockSurface( MYSDLSCREEN );
+	return false;
 }
 
-void Shoot::hit( Spaceobject *object ) {}
-
-void Shoot::calculate_ShootPath( Vector_2 start, Vector_2 direction, Galaxy *galaxy )
+void Shootpath::calculate( Vector_2 start, Vector_2 direction, Galaxy *galaxy )
 {
-	static Vector_2 last_angle=Vector_2( 0, 0, K );
-	static Vector_2 last_shoot=Vector_2( 0, 0, K );
+	if ( positions == NULL )
+		positions = new Step[MAXPRECALC];
 
-	if ( last_angle != direction || last_shoot != start ) {
+	// Stones move, so the Path changes with each Tick
+	if ( last_direction != direction || last_start != start || last_tick != galaxy->get_Tick() ) {
 
-		pre_calculated_Steps = 0;
-		last_angle = direction;
-		last_shoot = start;
+		steps = 0;
+		last_direction = direction;
+		last_start = start;
+		last_tick = galaxy->get_Tick();
 		
+		// Step i of the Shoot is done i+1 Ticks from now, when the
+		// Planets and Stones have moved on
 		for ( int i=0; i < MAXPRECALC; i++ ) {
-			galaxy->calculate_nextPos( start, direction );
+			galaxy->calculate_nextPos( start, direction, i+1 );
 			double x = start.getX();
 			double y = start.getY();
 			
-			if ( !galaxy->check_collision( x, y, get_Width() ) ) {	
-				pre_calculated_Pos[i].x = (int)x;
-				pre_calculated_Pos[i].y = (int)y; 
-				pre_calculated_Steps++;
-			} else break; 
+			positions[i].x = (int)x;
+			positions[i].y = (int)y; 
+			steps++;
+
+			// The last Step is where the Shoot hits something
+			if ( galaxy->check_collision( x, y, width, false, i+1 ) )
+				break; 
 		}
 	}
 }
 
 /************************************************************************
  *									*
- * Laser								*	
+ * Hintpreview								*	
  *									*
  ************************************************************************/
-Laser::Laser( double x, double y )
+Hintpreview::Hintpreview( Galaxy *galaxy, double width, int levels )
 :
-	Shoot( x, y )
+	galaxy(galaxy),
+	width(width),
+	levels(levels),
+	start( Vector_2( 0, 0, K ) ),
+	angle(0),
+	tick(-1),
+	requested(0),
+	quit(false)
 {
-	verbose( "Initializing Laser" );
-	
-	laser_sprite = new Sprite( "gfx/shoot.gif" );
-	laserback_sprite = new Sprite( "gfx/shootback.gif" );
-	laserbackk_sprite = new Sprite( "gfx/shootbackk.gif" );
+	verbose( "Initializing Hintpreview" );
 
-	width = laser_sprite->getWidth();
-}
-	
-Laser::~Laser()
-{
-	verbose( "Deleting Laser" );
+	paths = new Step[ MAXHINTS*MAXPRECALC ];
+	shown = new Step[ MAXHINTS*MAXPRECALC ];
 
-	delete laser_sprite;
-	delete laserback_sprite;
-	delete laserbackk_sprite;
+	for ( int i=0; i < MAXHINTS; i++ )
+		steps[i] = shown_steps[i] = 0;
+
+	lock = SDL_CreateMutex();
+	wake = SDL_CreateCond();
+	thread = SDL_CreateThread( Hintpreview::preview_Thread, this );
 }
 
-bool Laser::is_active() const
+Hintpreview::~Hintpreview()
 {
-	return moving_time > 0;
+	verbose( "Deleting Hintpreview" );
+
+	SDL_LockMutex( lock );
+	quit = true;
+	SDL_CondSignal( wake );
+	SDL_UnlockMutex( lock );
+
+	SDL_WaitThread( thread, NULL );
+
+	SDL_DestroyCond( wake );
+	SDL_DestroyMutex( lock );
+
+	delete[] paths;
+	delete[] shown;
 }
-	
-void Laser::destroy() 
+
+void Hintpreview::request( Vector_2 start, double angle )
 {
-	if ( is_active() )
-		hit( this );
+	SDL_LockMutex( lock );
+
+	// The Path only changes with the Shoot or when the Stones move on
+	if ( start != this->start || angle != this->angle || galaxy->get_Tick() != tick ) {
+		this->start = start;
+		this->angle = angle;
+		tick = galaxy->get_Tick();
+		requested++;
+
+		SDL_CondSignal( wake );
+	}
+
+	SDL_UnlockMutex( lock );
 }
 
-bool Laser::move( Galaxy *galaxy )
+void Hintpreview::draw()
 {
-	if ( is_active() ) {
-		if ( --moving_time == 0 ) return true;
+	static int colorpos = 50;
 	
-		Vector_2 my_shootPos = Vector_2( get_X(), get_Y(), K );
-		Vector_2 my_shootVector = Vector_2( speed, direction, P );
-		last_shootPos = my_shootPos;
-		
-		galaxy->calculate_nextPos( my_shootPos, my_shootVector );
+	if ( (colorpos -= 20) < 50 ) colorpos = 255;
 
-		x = my_shootPos.getX();
-		y = my_shootPos.getY();
-		speed = my_shootVector.getLength();
-		direction = my_shootVector.getAngle();
-		
-		if ( galaxy->has_collision( this ) &&
-			!is_active() )
-			
-			return true;
+	SDL_LockMutex( lock );
+	Sprite::lockScreen();
+
+	for ( int level=0; level < levels; level++ ) {
+		const Step *path = &shown[ level*MAXPRECALC ];
+		int c = colorpos;
+
+		for ( int i=0; i < shown_steps[level]; i++ ) {
+			Sprite::putpixel( 
+				path[i].x + Sprite::x_offset,
+				path[i].y + Sprite::y_offset,
+				SDL_MapRGB( MYSDLSCREEN->format, c, c, c ) );
+
+			if ( (c += 30) > 255 ) c = 50;
+		}
 	}
-	
-	return false;
+
+	Sprite::unlockScreen();
+	SDL_UnlockMutex( lock );
 }
-	
-bool Laser::has_Extra_collision( Extra *extra ) 
+
+bool Hintpreview::calculate( int serial, Vector_2 start, double angle )
 {
-	if ( extra->has_collision( (Spaceobject *)this ) )
-		return true;
-	
-	return false;
+	// The Game goes on meanwhile, it only waits for the Copy
+	galaxy->copy_Entities( entities );
+
+	for ( int level=0; level < levels; level++ ) {
+		Step *path = &paths[ level*MAXPRECALC ];
+		double power = MAXSHOOTPOWER * ( levels-level ) / levels;
+		Vector_2 position = start;
+		Vector_2 direction = Vector_2( power*SHOOTPOWERFACTOR, angle, P );
+
+		steps[level] = 0;
+
+		for ( int i=0; i < MAXPRECALC; i++ ) {
+
+			// Latest wins: a newer Request stops this one
+			if ( i % HINTCHECKSTEPS == 0 && !is_Wanted( serial ) )
+				return false;
+
+			Galaxy::calculate_nextPos( entities, position, direction, i+1 );
+			double x = position.getX();
+			double y = position.getY();
+
+			path[i].x = (int)x;
+			path[i].y = (int)y; 
+			steps[level]++;
+
+			if ( entities.find_collision( x, y, width, false, i+1 ) >= 0 )
+				break; 
+		}
+	}
+
+	return true;
 }
 
-bool Laser::check_collision( double x, double y, double width, bool spacing )
+bool Hintpreview::is_Wanted( int serial )
 {
-	return check_sphere_collision( x, y, width, spacing );
+	SDL_LockMutex( lock );
+	bool wanted = !quit && serial == requested;
+	SDL_UnlockMutex( lock );
+
+	return wanted;
 }
 
-void Laser::draw()
+int Hintpreview::preview_Thread( void *data )
 {
-	if ( is_active() ) {
+	Hintpreview *preview = (Hintpreview *)data;
+	int done = 0;
 
-		if ( moving_time > 100 ||
-			(int)RANDOM(100, 0) < ( moving_time/2 )+25 ) {
-			
-			double x_anim = RANDOM(2, -2);
-			double y_anim = RANDOM(2, -2);
-			int alpha_anim = (int)RANDOM(10, -10);
-			
-			Vector_2 v = last_shootPos-Vector_2( get_X(), get_Y(), K );
-			Vector_2 v_1 = v*0.5;
-			Vector_2 v_2 = v*0.2;
-			
-			laserbackk_sprite->setAlpha( 120+alpha_anim );
-			laserbackk_sprite->setPos(
-				(int)( get_X()+v_1.getX() ),
-				(int)( get_Y()+v_1.getY() ) );				
-			laserbackk_sprite->draw();
-
-			laserback_sprite->setAlpha( 140+alpha_anim );
-			laserback_sprite->setPos(
-				(int)( get_X()+v_2.getX() + x_anim ),
-				(int)( get_Y()+v_2.getY() + y_anim ) );				
-			laserback_sprite->draw();
-			
-			laser_sprite->setAlpha( 200+alpha_anim );
-			laser_sprite->setPos( (int)get_X(), (int)get_Y() );
-			laser_sprite->draw();
+	SDL_LockMutex( preview->lock );
+
+	while ( true ) {
+
+		while ( !preview->quit && preview->requested == done )
+			SDL_CondWait( preview->wake, preview->lock );
+
+		if ( preview->quit )
+			break;
+
+		int serial = done = preview->requested;
+		Vector_2 start = preview->start;
+		double angle = preview->angle;
+
+		SDL_UnlockMutex( preview->lock );
+
+		bool finished = preview->calculate( serial, start, angle );
+
+		SDL_LockMutex( preview->lock );
+
+		// Only a finished Request is shown
+		if ( finished ) {
+			Step *t = preview->shown;
+			preview->shown = preview->paths;
+			preview->paths = t;
+
+			for ( int i=0; i < preview->levels; i++ )
+				preview->shown_steps[i] = preview->steps[i];
 		}
 	}
-	
-	if ( is_exploding ) {
-		explosion->draw();
-		is_exploding = explosion->is_active();
-	}
-}
 
-void Laser::hit( Spaceobject *object )
-{
-	explosion->activate( x, y );
-	is_exploding = true;
-	moving_time = 0;
+	SDL_UnlockMutex( preview->lock );
+
+	return 0;
 }
 
 /************************************************************************
  *									*
- * Heavy								*	
+ * Projectile								*	
  *									*
  ************************************************************************/
-Heavy::Heavy( double x, double y )
+Projectile::Projectile()
 :
-	Shoot( x, y )
-{
-	verbose( "Initializing Heavy" );
-
-	weight = 2;
-	
-	heavy_sprite = new Sprite( "gfx/heavy.gif" );
-	heavyback_sprite = new Sprite( "gfx/heavyback.gif" );
-	heavybackk_sprite = new Sprite( "gfx/heavybackk.gif" );
+	Spaceobject(),
+	pool(NULL),
+	weapon(WEAPON_LASER),
+	moving_time(0),
+	last_x(0),
+	last_y(0)
+{}
 
-	width = heavy_sprite->getWidth();
-}
-	
-Heavy::~Heavy()
+void Projectile::launch( Projectiles *pool, int weapon, Vector_2 start, Vector_2 vector, 
+	double width, double weight )
 {
-	verbose( "Deleting Heavy" );
-
-	delete heavy_sprite;
-	delete heavyback_sprite;
-	delete heavybackk_sprite;
+	this->pool = pool;
+	this->weapon = weapon;
+	this->width = width;
+	this->weight = weight;
+	set_Pos( start.getX(), start.getY() );
+	keep_Position();
+	last_x = start.getX();
+	last_y = start.getY();
+	direction = vector.getAngle();
+	speed = vector.getLength();
+	moving_time = MAXSHOOTRUN;
 }
-	
-bool Heavy::is_active() const
+
+bool Projectile::is_active() const
 {
 	return moving_time > 0;
 }
 
-void Heavy::destroy() 
+int Projectile::get_Weapon() const
 {
-	if ( is_active() )
-		hit( this );
+	return weapon;
 }
 
-bool Heavy::move( Galaxy *galaxy )
+int Projectile::get_MovingTime() const
 {
-	if ( is_active() ) {
-		
-		if ( --moving_time == 0 ) return true;
-	
-		Vector_2 my_shootPos = Vector_2( get_X(), get_Y(), K );
-		Vector_2 my_shootVector = Vector_2( speed, direction, P );
-		last_shootPos = my_shootPos;
-		
-		galaxy->calculate_nextPos( my_shootPos, my_shootVector );
-
-		x = my_shootPos.getX();
-		y = my_shootPos.getY();
-		speed = my_shootVector.getLength();
-		direction = my_shootVector.getAngle();
-		
-		if ( galaxy->has_collision( this ) &&
-			!is_active() )
-			
-			return true;
-	}
-	
-	return false;
+	return moving_time;
 }
-	
-bool Heavy::has_Extra_collision( Extra *extra ) 
+
+double Projectile::get_LastX() const
 {
-	if ( extra->has_collision( (Spaceobject *)this ) )
-		return true;
-	
-	return false;
+	return last_x;
 }
 
-bool Heavy::check_collision( double x, double y, double width, bool spacing )
+double Projectile::get_LastY() const
 {
-	return check_sphere_collision( x, y, width, spacing );
+	return last_y;
 }
 
-void Heavy::draw()
+bool Projectile::age()
 {
-	if ( is_active() ) {
+	return --moving_time > 0;
+}
 
-		if ( moving_time > 100 ||
-			(int)RANDOM(100, 0) < ( moving_time/2 )+25 ) {
-			
-			double x_anim = RANDOM(2, -2);
-			double y_anim = RANDOM(2, -2);
-			int alpha_anim = (int)RANDOM(10, -10);
-			
-			Vector_2 v = last_shootPos-Vector_2( get_X(), get_Y(), K );
-			Vector_2 v_1 = v * 0.5;
-			Vector_2 v_2 = v * 0.2;
-			
-			heavy_sprite->setAlpha( 200 + alpha_anim );
-			heavy_sprite->setPos( (int)get_X(), (int)get_Y() );
-			heavy_sprite->draw();
-
-			heavybackk_sprite->setAlpha( 100 + alpha_anim );
-			heavybackk_sprite->setPos(
-				(int)( get_X() + v_1.getX() ),
-				(int)( get_Y() + v_1.getY() ) );				
-			heavybackk_sprite->draw();
-
-			heavyback_sprite->setAlpha( 130 + alpha_anim );
-			heavyback_sprite->setPos(
-				(int)( get_X() + v_2.getX() + x_anim ),
-				(int)( get_Y() + v_2.getY() + y_anim ) );				
-			heavyback_sprite->draw();			
-		}
-	}
+void Projectile::fly( Galaxy *galaxy )
+{
+	Vector_2 my_shootPos = Vector_2( get_X(), get_Y(), K );
+	Vector_2 my_shootVector = Vector_2( speed, direction, P );
+	last_x = x;
+	last_y = y;
+	keep_Position();
 	
-	if ( is_exploding ) {
-		explosion->draw();
-		is_exploding = explosion->is_active();
-	}
+	galaxy->calculate_nextPos( my_shootPos, my_shootVector );
+
+	x = my_shootPos.getX();
+	y = my_shootPos.getY();
+	speed = my_shootVector.getLength();
+	direction = my_shootVector.getAngle();
 }
 
-void Heavy::hit( Spaceobject *object )
+void Projectile::kill()
 {
-	explosion->activate( x, y );
-	is_exploding = true;
 	moving_time = 0;
 }
 
+bool Projectile::check_collision( double x, double y, double width, bool spacing )
+{
+	return check_sphere_collision( x, y, width, spacing );
+}
+
+void Projectile::hit( Spaceobject *object )
+{
+	pool->explode( this, object );
+}
+
 /************************************************************************
  *									*
- * Cluster								*	
+ * Projectiles								*	
  *									*
  ************************************************************************/
-Cluster::Cluster( double x, double y )
+Projectiles::Projectiles()
 :
-	Shoot( x, y ),
-	lasers_active(false)
+	next_explosion(0),
+	was_active(false)
 {
-	verbose( "Initializing Cluster" );
+	verbose( "Initializing Projectiles" );
 
-	reset();
-
-	cluster_sprite = new Sprite( "gfx/shoot.gif" );
-	clusterback_sprite = new Sprite( "gfx/shootback.gif" );
-	clusterbackk_sprite = new Sprite( "gfx/shootbackk.gif" );
+	laser_sprite = new Sprite( "gfx/shoot.gif" );
+	laserback_sprite = new Sprite( "gfx/shootback.gif" );
+	laserbackk_sprite = new Sprite( "gfx/shootbackk.gif" );
+	heavy_sprite = new Sprite( "gfx/heavy.gif" );
+	heavyback_sprite = new Sprite( "gfx/heavyback.gif" );
+	heavybackk_sprite = new Sprite( "gfx/heavybackk.gif" );
 
-	width = cluster_sprite->getWidth();
-	
-	lasers = new Laser[MAXCLUSTERLASER];
+	for ( int i=0; i < MAXEXPLOSIONS; i++ )
+		explosions[i] = new Explosion();
 }
-	
-Cluster::~Cluster()
+
+Projectiles::~Projectiles()
 {
-	verbose( "Deleting Cluster" );
+	verbose( "Deleting Projectiles" );
 
-	delete cluster_sprite;
-	delete clusterback_sprite;
-	delete clusterbackk_sprite;
-	delete[] lasers;
+	delete laser_sprite;
+	delete laserback_sprite;
+	delete laserbackk_sprite;
+	delete heavy_sprite;
+	delete heavyback_sprite;
+	delete heavybackk_sprite;
+
+	for ( int i=0; i < MAXEXPLOSIONS; i++ )
+		delete explosions[i];
 }
-	
-bool Cluster::is_active() const
+
+bool Projectiles::launch( int weapon, Vector_2 start, Vector_2 vector )
 {
-	for ( int i=0; i < MAXCLUSTERLASER; i++ )
-		if ( lasers[i].is_active() )
+	for ( int i=0; i < MAXPROJECTILES; i++ ) {
+
+		if ( !projectiles[i].is_active() ) {
+			projectiles[i].launch( this, weapon, start, vector, get_Width( weapon ),
+				( weapon == WEAPON_HEAVY ) ? 2 : 1 );
+
+			sound->play(SOUND_SHOOT);
+
+			// A Shot that explodes in its first Step ends the Turn too
+			was_active = true;
+
 			return true;
+		}
+	}
 
-	return moving_time>0;
+	return false;
 }
 
-void Cluster::reset() 
+bool Projectiles::is_active() const
 {
-	destroyed = false;
-	laser_hits = 0;
-	moving_time = 0;
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		if ( projectiles[i].is_active() )
+			return true;
+
+	return false;
 }
 
-void Cluster::destroy() 
+const Projectile *Projectiles::get_Leader() const
 {
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		if ( projectiles[i].is_active() )
+			return &projectiles[i];
 
-	for ( int i=0; i < MAXCLUSTERLASER; i++ )
-		if ( lasers[i].is_active() )
-			lasers[i].hit(this);
+	return NULL;
+}
 
-	if ( is_active() ) {
-		destroyed = true;
-		hit( this );
-	}
+double Projectiles::get_Width( int weapon ) const
+{
+	return ( weapon == WEAPON_HEAVY ) ? heavy_sprite->getWidth() : laser_sprite->getWidth();
 }
 
-bool Cluster::move( Galaxy *galaxy )
+bool Projectiles::move( Galaxy *galaxy )
 {
-	if ( destroyed )
-		return true;
+	int flying[MAXPROJECTILES], amount = 0;
 
-	if ( moving_time > 0 ) {
+	// Projectiles launched in this Tick (Cluster-Lasers) start with the next
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		if ( projectiles[i].is_active() && projectiles[i].age() )
+			flying[amount++] = i;
 
-		if ( --moving_time == 0 )
-			return true;
+	for ( int k=0; k < amount; k++ )
+		projectiles[ flying[k] ].fly( galaxy );
 
-		else {		
-			Vector_2 my_shootPos = Vector_2( get_X(), get_Y(), K );
-			Vector_2 my_shootVector = Vector_2( speed, direction, P );
-			last_shootPos = my_shootPos;
-			
-			galaxy->calculate_nextPos( my_shootPos, my_shootVector );
-	
-			x = my_shootPos.getX();
-			y = my_shootPos.getY();
-			speed = my_shootVector.getLength();
-			direction = my_shootVector.getAngle();
-			
-			if ( galaxy->has_collision( this ) ) {
-				laser_hits++;
-			}
-		}
-	}
-	
-	for ( int i=0; i < MAXCLUSTERLASER; i++ )
-		if ( lasers[i].is_active() && lasers[i].move( galaxy ) )
-			laser_hits++;
+	for ( int k=0; k < amount; k++ )
+		if ( projectiles[ flying[k] ].is_active() )
+			galaxy->has_collision( &projectiles[ flying[k] ] );
 
-	if ( laser_hits >= MAXCLUSTERLASER + 1 )
-		return true;
+	bool finished = was_active && !is_active();
 
-	return false;
+	was_active = is_active();
+
+	return finished;
 }
 
-bool Cluster::has_Extra_collision( Extra *extra ) 
+void Projectiles::destroy()
 {
-	if ( is_active() && extra->has_collision( (Spaceobject *)this ) )
-		return true;
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		explode( &projectiles[i], NULL );
 
-	for ( int i=0; i < MAXCLUSTERLASER; i++ ) {
-		if ( lasers[i].is_active() && extra->has_collision( (Spaceobject *)&lasers[i] ) )
-			return true;
-	}
-	
-	return false;
+	was_active = false;
 }
 
-bool Cluster::check_collision( double x, double y, double width, bool spacing )
+bool Projectiles::has_Extra_collision( Extra *extra )
 {
-	for ( int i=0; i < MAXCLUSTERLASER; i++ )
-		if ( lasers[i].check_collision( x, y, width, spacing ) )
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		if ( projectiles[i].is_active() && extra->has_collision( &projectiles[i] ) )
 			return true;
 
-	return check_sphere_collision( x, y, width, spacing );
+	return false;
 }
 
-void Cluster::draw()
+void Projectiles::explode( Projectile *projectile, Spaceobject *object )
 {
-	if ( moving_time > 0 ) {
+	if ( !projectile->is_active() )
+		return;
+
+	explosions[next_explosion]->activate( projectile->get_X(), projectile->get_Y() );
+	next_explosion = ( next_explosion+1 ) % MAXEXPLOSIONS;
+	projectile->kill();
+
+	// Clusters split into Lasers that fly away from the Object
+	if ( object != NULL && 
+		( projectile->get_Weapon() == WEAPON_CLUSTER || projectile->get_Weapon() == WEAPON_FUNGHI ) ) {
+
+		Vector_2 v_hit_vector = Vector_2( projectile->get_X(), projectile->get_Y(), K )
+			- Vector_2( object->get_X(), object->get_Y(), K );
+		Vector_2 v_hit_start = Vector_2( projectile->get_X(), projectile->get_Y(), K );
+		double dir = v_hit_vector.getAngle()-( CLUSTERLASERANGLE*MAXCLUSTERLASER/2 ) * PI / 180;
 		
-		if ( moving_time > 100 ||
-			(int)RANDOM(100, 0) < ( moving_time/2 )+25 ) {
-			
-			double x_anim = RANDOM(2, -2);
-			double y_anim = RANDOM(2, -2);
-			int alpha_anim = (int)RANDOM(10, -10);
-			
-			Vector_2 v = last_shootPos-Vector_2( get_X(), get_Y(), K );
-			Vector_2 v_1 = v * 0.5;
-			Vector_2 v_2 = v * 0.2;
-			
-			clusterbackk_sprite->setAlpha( 120 + alpha_anim );
-			clusterbackk_sprite->setPos(
-				(int)( get_X() + v_1.getX() ),
-				(int)( get_Y() + v_1.getY() ) );				
-			clusterbackk_sprite->draw();
-
-			clusterback_sprite->setAlpha( 140 + alpha_anim );
-			clusterback_sprite->setPos(
-				(int)( get_X() + v_2.getX() + x_anim ),
-				(int)( get_Y() + v_2.getY() + y_anim ) );				
-			clusterback_sprite->draw();
-			
-			cluster_sprite->setAlpha( 200 + alpha_anim );
-			cluster_sprite->setPos( (int)get_X(), (int)get_Y() );
-			cluster_sprite->draw();
+		for ( int i=0; i < MAXCLUSTERLASER; i++ ) {
+			Vector_2 v_direction = Vector_2( projectile->get_Speed() / 5 * 3, dir, P );
+			Vector_2 v_start = v_hit_start + Vector_2( 10, dir, P );
+			launch( WEAPON_LASER, v_start, v_direction );
+			dir += CLUSTERLASERANGLE*PI/180;
 		}
 	}
-	
-	for (int i=0; i < MAXCLUSTERLASER; i++)
-		lasers[i].draw();
+}
 
-	if ( is_exploding ) {
-		explosion->draw();
-		is_exploding = explosion->is_active();
-	}
+void Projectiles::draw()
+{
+	for ( int i=0; i < MAXPROJECTILES; i++ )
+		if ( projectiles[i].is_active() )
+			draw_Projectile( projectiles[i] );
+
+	for ( int i=0; i < MAXEXPLOSIONS; i++ )
+		explosions[i]->draw();
 }
 
-void Cluster::hit( Spaceobject *object )
+void Projectiles::draw_Projectile( const Projectile &projectile )
 {
-	if ( moving_time > 0 ) {
+	int moving_time = projectile.get_MovingTime();
 
-		explosion->activate( x, y );
-		is_exploding = true;
-		moving_time = 0;
+	// Old Projectiles flicker
+	if ( moving_time <= 100 &&
+		(int)RANDOM_FX(100, 0) >= ( moving_time/2 )+25 ) 
+		return;
 
-		if ( !destroyed ) {
-			Vector_2 v_hit_vector = Vector_2( get_X(), get_Y(), K )-Vector_2( object->get_X(), object->get_Y(), K );
-			Vector_2 v_hit_start = Vector_2( get_X(), get_Y(), K );
-			double dir = v_hit_vector.getAngle()-( CLUSTERLASERANGLE*MAXCLUSTERLASER/2 ) * PI / 180;
-			
-			for ( int i=0; i < MAXCLUSTERLASER; i++ ) {
-				Vector_2 v_direction = Vector_2( get_Speed() / 5 * 3, dir, P );
-				Vector_2 v_start = v_hit_start + Vector_2( 10, dir, P );
-				lasers[i].activate( v_start, v_direction );
-				dir += CLUSTERLASERANGLE*PI/180;
-			}
-		} 
+	double x = projectile.get_DrawX(),
+		y = projectile.get_DrawY();
+	double x_anim = RANDOM_FX(2, -2);
+	double y_anim = RANDOM_FX(2, -2);
+	int alpha_anim = (int)RANDOM_FX(10, -10);
+	
+	Vector_2 v = Vector_2( projectile.get_LastX(), projectile.get_LastY(), K ) 
+		- Vector_2( projectile.get_X(), projectile.get_Y(), K );
+	Vector_2 v_1 = v * 0.5;
+	Vector_2 v_2 = v * 0.2;
+
+	if ( projectile.get_Weapon() == WEAPON_HEAVY ) {
+		heavy_sprite->setAlpha( 200 + alpha_anim );
+		heavy_sprite->setPos( (int)x, (int)y );
+		heavy_sprite->draw();
+
+		heavybackk_sprite->setAlpha( 100 + alpha_anim );
+		heavybackk_sprite->setPos( (int)( x + v_1.getX() ), (int)( y + v_1.getY() ) );				
+		heavybackk_sprite->draw();
+
+		heavyback_sprite->setAlpha( 130 + alpha_anim );
+		heavyback_sprite->setPos( (int)( x + v_2.getX() + x_anim ), (int)( y + v_2.getY() + y_anim ) );				
+		heavyback_sprite->draw();			
+	} else {
+		laserbackk_sprite->setAlpha( 120 + alpha_anim );
+		laserbackk_sprite->setPos( (int)( x + v_1.getX() ), (int)( y + v_1.getY() ) );				
+		laserbackk_sprite->draw();
+
+		laserback_sprite->setAlpha( 140 + alpha_anim );
+		laserback_sprite->setPos( (int)( x + v_2.getX() + x_anim ), (int)( y + v_2.getY() + y_anim ) );				
+		laserback_sprite->draw();
+		
+		laser_sprite->setAlpha( 200 + alpha_anim );
+		laser_sprite->setPos( (int)x, (int)y );
+		laser_sprite->draw();
 	}
 }
@@ -7,11 +7,21 @@
  * 
  * Explosion - Small Class for an Explosion
  *
- * Shoot - Main Class for a Shoot. Contains it's Explosion
+ * Shootpath - The precalculated Way of a Shoot for the Computer-Player.
+ * Flying Shoots don't need one.
+ *
+ * Hintpreview - The Paths of the Hint, calculated by an own Thread.
+ * Only the latest Request counts, the Game never waits for it.
+ *
+ * Projectile - One flying Shoot. It only knows its Position, Weapon and
+ * how long it flies; Sprites and Explosions belong to the Pool.
+ *
+ * Projectiles - Pool of all Projectiles of the Galaxy. All of them are
+ * moved together, so Salvos and Clusters need no new Objects:
  *
  * Lasers - Normal Shoot
  *
- * Cluster - Cluster Shoot. If it explodes (Timeout or Hit) it will release
+ * Cluster - Cluster Shoot. If it explodes (Hit) it will release
  * more Shoots
  *
  * Heavy - Low Gravity and high strength
@@ -43,10 +53,12 @@
 
 #include "constants.hpp"
 #include "graphics.hpp"
+#include "entities.hpp"
 #include "galaxy.hpp"
 
 class Galaxy;
 class Extra;
+class Ufo;
 
 /************************************************************************
  *									*
@@ -79,161 +91,202 @@ private:
 
 /************************************************************************
  *									*
- * Shoot 								*	
+ * Shootpath								*	
  *									*
  ************************************************************************/
- class Shoot : public Spaceobject
- {
- public:
-	Shoot( double x=0, double y=0 );
-
-	~Shoot();
-	
-	virtual bool is_active() const;
-
-	bool will_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy );
-
-	void activate( Vector_2 start, Vector_2 vector );
-
-	virtual void reset();
+class Shootpath
+{
+public:
+	Shootpath( double width=0 );
 
-	virtual void destroy();
+	~Shootpath();
 
-	virtual bool move( Galaxy *galaxy );
+	// Closest Approach of a Path to a Flying Saucer
+	struct Approach {
+		Ufo *ufo;
+		double distance;	// From the Path to the Center of the Saucer
+		int step;		// Step of the Path that comes closest
+	};
 
-	virtual bool has_Extra_collision( Extra *extra );
-	
-	virtual bool check_collision( double x, double y, double width, bool spacing=false );
+	// True if the Path comes within get_Reach() of a Saucer of another Team
+	bool will_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy );
 
-	virtual void draw();
+	// The Closest Approach of the Path to each living Saucer of another
+	// Team than player_id, measured between the Steps and not only at
+	// them. Fills up to MAXPLAYER approaches and returns how many.
+	int get_Approaches( int player_id, Vector_2 start, Vector_2 direction, Galaxy *galaxy, 
+		Approach *approaches );
 
-	void draw_hint( Vector_2 start, Vector_2 direction, Galaxy *galaxy );
+	// How close a Path must come to the Center of the Saucer to hit it.
+	// A bigger factor is a worse Aim.
+	static double get_Reach( const Ufo *ufo, double factor );
 
-	virtual void hit( Spaceobject *object );
+	// A cheap first Look with COARSESTEPS Steps in one and a wider Aim.
+	// Only if it returns true the Shoot may hit; will_be_a_Hit() knows.
+	bool might_be_a_Hit( int player_id, double factor, Vector_2 start, Vector_2 direction, Galaxy *galaxy );
 
-protected:
-	bool is_exploding;
-	int moving_time;
-	Vector_2 last_shootPos;
-	int pre_calculated_Steps;
+private:
+	double width;
+	int steps;
+	Vector_2 last_start, last_direction;
+	int last_tick;
 
-	struct { 
+	// MAXPRECALC Steps, taken at the first calculate()
+	struct Step {
 		int x, y;
-	} pre_calculated_Pos[MAXPRECALC];
-	
-	Explosion *explosion;
+	} *positions;
 
-	void calculate_ShootPath( Vector_2 start, Vector_2 direction, Galaxy *galaxy );  
+	// Nothing is calculated again for the same Start, Direction and Tick
+	void calculate( Vector_2 start, Vector_2 direction, Galaxy *galaxy );
 };
 
 /************************************************************************
  *									*
- * Laser								*	
+ * Hintpreview								*	
  *									*
  ************************************************************************/
-class Laser : public Shoot
+class Hintpreview
 {
-public:	
-	Laser( double x=0, double y=0 );
-	
-	~Laser();
-	
-	bool is_active() const;
-
-	void reset() {};
+public:
+	// levels Paths, from full Power down (see --hints)
+	Hintpreview( Galaxy *galaxy, double width, int levels );
 
-	void destroy();
-	
-	bool move( Galaxy *galaxy );
-	
-	bool has_Extra_collision( Extra *extra );
+	~Hintpreview();
 
-	bool check_collision( double x, double y, double width, bool spacing=false );
+	// Asks for the Paths of a Shoot from start in angle. A Request that
+	// is not finished yet is given up.
+	void request( Vector_2 start, double angle );
 
+	// Draws the Paths of the latest finished Request
 	void draw();
 
-	void hit( Spaceobject *object );
-
 private:
-	Sprite *laser_sprite,
-		*laserback_sprite,
-		*laserbackk_sprite;
+	struct Step {
+		int x, y;
+	};
 
+	Galaxy *galaxy;
+	Entities entities;			// Copy of the Thread (see Galaxy::copy_Entities)
+	double width;
+	int levels;
+
+	Vector_2 start;				// The latest Request
+	double angle;
+	int tick, requested;
+	bool quit;
+
+	// The Thread calculates into paths, finished Paths are swapped
+	// into shown
+	Step *paths, *shown;
+	int steps[MAXHINTS], shown_steps[MAXHINTS];
+
+	SDL_mutex *lock;
+	SDL_cond *wake;
+	SDL_Thread *thread;
+
+	// Returns false if a newer Request came in
+	bool calculate( int serial, Vector_2 start, double angle );
+
+	bool is_Wanted( int serial );
+
+	static int preview_Thread( void *data );
 };
 
+class Projectiles;
+
 /************************************************************************
  *									*
- * Heavy								*	
+ * Projectile								*	
  *									*
  ************************************************************************/
-class Heavy : public Shoot
+class Projectile : public Spaceobject
 {
-public:	
-	Heavy( double x=0, double y=0 );
-	
-	~Heavy();
-	
+public:
+	Projectile();
+
+	void launch( Projectiles *pool, int weapon, Vector_2 start, Vector_2 vector, 
+		double width, double weight );
+
 	bool is_active() const;
 
-	void reset() {};
+	int get_Weapon() const;
 
-	void destroy();
-	
-	bool move( Galaxy *galaxy );
-	
-	bool has_Extra_collision( Extra *extra );
+	int get_MovingTime() const;
+
+	double get_LastX() const;
+
+	double get_LastY() const;
+
+	// Returns false if the Projectile has flown long enough
+	bool age();
+
+	// One Step through the Gravity of the Galaxy
+	void fly( Galaxy *galaxy );
+
+	void kill();
 
 	bool check_collision( double x, double y, double width, bool spacing=false );
-	
-	void draw();
 
 	void hit( Spaceobject *object );
 
 private:
-	Sprite *heavy_sprite,
-		*heavyback_sprite,
-		*heavybackk_sprite;
-
+	Projectiles *pool;
+	int weapon;
+	int moving_time;
+	double last_x, last_y;
 };
 
 /************************************************************************
  *									*
- * Cluster								*	
+ * Projectiles								*	
  *									*
  ************************************************************************/
-class Cluster : public Shoot
+class Projectiles
 {
-public:	
-	Cluster( double x=0, double y=0 );
-	
-	~Cluster();
-	
+public:
+	Projectiles();
+
+	~Projectiles();
+
+	// Returns false if all MAXPROJECTILES are flying
+	bool launch( int weapon, Vector_2 start, Vector_2 vector );
+
 	bool is_active() const;
 
-	void reset();
+	// The first flying Projectile (the Screen follows it) or NULL
+	const Projectile *get_Leader() const;
 
-	void destroy();
-	
+	double get_Width( int weapon ) const;
+
+	// Moves all flying Projectiles one Tick: first all of them through
+	// the Gravity, then all Collisions. Returns true when the last
+	// Projectile is gone.
 	bool move( Galaxy *galaxy );
-	
+
+	// All Projectiles explode, Clusters don't split
+	void destroy();
+
 	bool has_Extra_collision( Extra *extra );
 
-	bool check_collision( double x, double y, double width, bool spacing=false );
-	
-	void draw();
+	// projectile has hit object (NULL if destroyed)
+	void explode( Projectile *projectile, Spaceobject *object );
 
-	void hit( Spaceobject *object );
+	void draw();
 
 private:
-	bool lasers_active;
-	bool destroyed;
-	int laser_hits;
-	
-	Sprite *cluster_sprite,
-		*clusterback_sprite,
-		*clusterbackk_sprite;
-	Laser *lasers;
+	Projectile projectiles[MAXPROJECTILES];
+	Explosion *explosions[MAXEXPLOSIONS];
+	int next_explosion;
+	bool was_active;
+
+	Sprite *laser_sprite,
+		*laserback_sprite,
+		*laserbackk_sprite,
+		*heavy_sprite,
+		*heavyback_sprite,
+		*heavybackk_sprite;
 
+	void draw_Projectile( const Projectile &projectile );
 };
 
 #endif
@@ -0,0 +1,254 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "shotcache.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "shotcache.hpp"
+
+const Uint32 SHOTCACHEVERSION = 2;
+
+/******************************************************************************************
+ *
+ * Shotcache
+ *
+ ******************************************************************************************/
+Shotcache::Shotcache( std::string filename )
+:
+	filename(filename),
+	data(NULL),
+	size( sizeof(Header) + SHOTCACHESLOTS * sizeof(Slot) ),
+	mapped(false),
+	changed(false),
+	header(NULL),
+	slots(NULL)
+{
+	#ifndef __WIN32__
+	// Each User has an own Cache, nobody else writes into it
+	const char *home = getenv( "HOME" );
+
+	if ( home != NULL && *home != 0 )
+		this->filename = std::string( home ) + "/" + filename;
+	#endif
+
+	verbose( "Initializing Shotcache: " + this->filename );
+
+	#ifndef __WIN32__
+	int fd = open( this->filename.c_str(), O_RDONLY );
+	struct stat status;
+
+	// Private: stored Shoots stay in this Game until it writes them back,
+	// the File itself is never changed (see write())
+	if ( fd >= 0 ) {
+
+		if ( fstat( fd, &status ) == 0 && (Uint32)status.st_size == size ) {
+			void *map = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+
+			if ( map != MAP_FAILED ) {
+				data = (Uint8 *)map;
+				mapped = true;
+			}
+		}
+
+		close( fd );
+	}
+	#else
+	FILE *file = fopen( this->filename.c_str(), "rb" );
+
+	data = (Uint8 *)malloc( size );
+
+	if ( file != NULL ) {
+
+		if ( data != NULL && fread( data, 1, size, file ) != size )
+			memset( data, 0, size );
+
+		fclose( file );
+	} 
+	else if ( data != NULL )
+		memset( data, 0, size );
+	#endif
+
+	// A new or broken File starts empty, clear() fills it
+	if ( data == NULL ) {
+
+		data = (Uint8 *)malloc( size );
+
+		if ( data == NULL ) {
+			std::cout << "Error in Shotcache: Out of Memory." << std::endl;
+			exit(1);
+		}
+
+		memset( data, 0, size );
+	}
+
+	header = (Header *)data;
+	slots = (Slot *)( data + sizeof(Header) );
+
+	if ( memcmp( header->magic, "HMSC", 4 ) != 0 
+		|| header->version != SHOTCACHEVERSION 
+		|| header->slots != (Uint32)SHOTCACHESLOTS )
+		clear();
+
+	int used = 0;
+
+	for ( int i=0; i < SHOTCACHESLOTS; i++ )
+		if ( slots[i].used )
+			used++;
+
+	std::ostringstream info;
+	info << "Shotcache knows " << used << " Shoots";
+	verbose( info.str() );
+}
+
+Shotcache::~Shotcache()
+{
+	verbose( "Deleting Shotcache" );
+
+	if ( changed && !write() )
+		verbose( "Shotcache can't write its File. The new Shoots are lost." );
+
+	#ifndef __WIN32__
+	if ( mapped ) {
+		munmap( data, size );
+		return;
+	}
+	#endif
+
+	free( data );
+}
+
+bool Shotcache::find( const Key &key, double &y, double &power, double &angle )
+{
+	Uint32 first = hash( key );
+
+	for ( int i=0; i < SHOTCACHEPROBES; i++ ) {
+		Slot &slot = slots[ ( first+i ) % SHOTCACHESLOTS ];
+
+		if ( slot.used && same( slot.key, key ) ) {
+			y = slot.y;
+			power = slot.power;
+			angle = slot.angle;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Shotcache::store( const Key &key, double y, double power, double angle )
+{
+	Uint32 first = hash( key );
+	Slot *slot = NULL;
+
+	// The same Key or a free Slot, if all are taken the first one
+	for ( int i=0; i < SHOTCACHEPROBES && slot == NULL; i++ ) {
+		Slot &s = slots[ ( first+i ) % SHOTCACHESLOTS ];
+
+		if ( !s.used || same( s.key, key ) )
+			slot = &s;
+	}
+
+	if ( slot == NULL )
+		slot = &slots[ first % SHOTCACHESLOTS ];
+
+	slot->key = key;
+	slot->y = y;
+	slot->power = power;
+	slot->angle = angle;
+	slot->used = 1;
+
+	changed = true;
+}
+
+Uint32 Shotcache::hash( const Key &key ) const
+{
+	Uint32 h = 2166136261u;
+	Uint32 values[] = { (Uint32)key.seed, (Uint32)key.type, (Uint32)key.planets, 
+		(Uint32)key.shooter_x, (Uint32)key.shooter_band, key.targets };
+
+	for ( int i=0; i < 6; i++ )
+		h = ( h ^ values[i] ) * 16777619u;
+
+	return h;
+}
+
+bool Shotcache::same( const Key &a, const Key &b )
+{
+	return a.seed == b.seed && a.type == b.type && a.planets == b.planets
+		&& a.shooter_x == b.shooter_x && a.shooter_band == b.shooter_band
+		&& a.targets == b.targets;
+}
+
+bool Shotcache::write()
+{
+	#ifndef __WIN32__
+	// A new File replaces the old one at once, so other Games that still
+	// map the old File keep it and never see it half written
+	std::ostringstream temporary;
+	temporary << filename << "." << getpid();
+
+	int fd = open( temporary.str().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+
+	if ( fd < 0 )
+		return false;
+
+	bool written = ::write( fd, data, size ) == (ssize_t)size;
+
+	if ( close( fd ) != 0 || !written || rename( temporary.str().c_str(), filename.c_str() ) != 0 ) {
+		unlink( temporary.str().c_str() );
+		return false;
+	}
+
+	return true;
+	#else
+	FILE *file = fopen( filename.c_str(), "wb" );
+
+	if ( file == NULL )
+		return false;
+
+	bool written = fwrite( data, 1, size, file ) == size;
+
+	return fclose( file ) == 0 && written;
+	#endif
+}
+
+void Shotcache::clear()
+{
+	memset( data, 0, size );
+	memcpy( header->magic, "HMSC", 4 );
+	header->version = SHOTCACHEVERSION;
+	header->slots = SHOTCACHESLOTS;
+}
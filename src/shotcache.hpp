@@ -0,0 +1,96 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "shotcache.hpp"
+ *
+ * Shotcache - Hitting Shoots the Computer has found, kept in a File
+ * for the next Games. A Shoot belongs to the Seed and Planets of the
+ * Galaxy and to the Bands of y where the Flying Saucers are. Each
+ * User has an own File (~/.highmoon.cache). It is mapped privately
+ * into Memory and replaced by a new one when the Game ends.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __SHOTCACHE_HPP__
+#define __SHOTCACHE_HPP__
+
+#include <SDL/SDL.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Shotcache
+ *
+ ******************************************************************************************/
+class Shotcache
+{
+public:
+	struct Key {
+		Sint32 seed, type, planets;
+		Sint32 shooter_x, shooter_band;
+		Uint32 targets;			// Sides and Bands of the other Teams
+	};
+
+	// filename is in the Home-Directory of the User. The Shoots are
+	// written back when the Cache is deleted.
+	Shotcache( std::string filename );
+
+	~Shotcache();
+
+	// Returns false if no Shoot is stored for that Key
+	bool find( const Key &key, double &y, double &power, double &angle );
+
+	// Replaces an old Shoot of the same Key
+	void store( const Key &key, double y, double power, double angle );
+
+private:
+	struct Header {
+		char magic[4];
+		Uint32 version;
+		Uint32 slots;
+	};
+
+	struct Slot {
+		Key key;
+		Uint32 used;
+		float y, power, angle;
+	};
+
+	std::string filename;
+	Uint8 *data;
+	Uint32 size;
+	bool mapped,
+		changed;
+	Header *header;
+	Slot *slots;
+
+	Uint32 hash( const Key &key ) const;
+
+	static bool same( const Key &a, const Key &b );
+
+	// Returns false if the File can't be written
+	bool write();
+
+	void clear();
+};
+
+#endif
@@ -26,6 +26,11 @@
 #include <iostream>
 
 #include "sound.hpp"
+#include "pack.hpp"
+#include "loader.hpp"
+
+extern Pack *pack;
+extern Loader *loader;
 
 Soundset::Sample Soundset::sounds[ NUMBEROFCHANNELS ];
 bool Soundset::soundOn = true;
@@ -34,16 +39,6 @@ Soundset::Soundset()
 {
 	verbose( "Initializing Soundset" );
 
-	char* SOUNDSETNAMES[] = { 
-		"snd/explosion.wav",	// 0
-		"snd/laser.wav",    	// 1
-		"snd/applause.wav",	// 2
-		"snd/curve.wav", 	// 3
-		"snd/kling.wav", 	// 4
-		"snd/pluck.wav", 	// 5
-		"snd/strom.wav",	// 6
-		"snd/click.wav" };	// 7
-
 	for ( int i=0; i < _SOUNDSETNAMES; i++ ) {
 		loadAudio( SOUNDSETNAMES[i], i );
 	}
@@ -60,7 +55,8 @@ Soundset::~Soundset()
 	SDL_CloseAudio();
 	
 	for ( int i=0; i < _SOUNDSETNAMES; i++ )
-		free( cvt[i].buf ); 
+		if ( !in_pack[i] )
+			free( samples[i] ); 
 }
 
 void Soundset::toggle()
@@ -83,8 +79,8 @@ void Soundset::play(SoundId id)
 		if ( index < NUMBEROFCHANNELS ) {
 			
 			SDL_LockAudio();
-			sounds[index].data = cvt[id].buf;
-			sounds[index].dlen = cvt[id].len_cvt;
+			sounds[index].data = samples[id];
+			sounds[index].dlen = lengths[id];
 			sounds[index].dpos = 0;
 			SDL_UnlockAudio();
 		}
@@ -93,9 +89,9 @@ void Soundset::play(SoundId id)
 
 void Soundset::start()
 {
-	format.freq = 22050;
+	format.freq = AUDIOFREQUENCY;
 	format.format = AUDIO_S16;
-	format.channels = 2;
+	format.channels = AUDIOCHANNELS;
 	format.samples = 512;
 	format.callback = &(Soundset::mixAudio);
 	format.userdata = NULL;
@@ -108,25 +104,49 @@ void Soundset::start()
 	SDL_PauseAudio(0);
 }
 
-void Soundset::loadAudio( char *filename, int id )
+void Soundset::loadAudio( const char *filename, int id )
+{
+	// A Pack already contains Samples in the Format of the Mixer
+	if ( pack != NULL && ( samples[id] = pack->get_Audio( filename, lengths[id] ) ) != NULL ) {
+		in_pack[id] = true;
+		return;
+	}
+
+	in_pack[id] = false;
+	samples[id] = NULL;
+
+	// The Loader may have converted it already
+	if ( loader != NULL )
+		samples[id] = loader->get_Audio( filename, lengths[id] );
+
+	if ( samples[id] == NULL && ( samples[id] = convert( filename, lengths[id] ) ) == NULL ) {
+		std::cout << "Error in Sound: " << SDL_GetError() << std::endl;
+		exit(1);
+	}
+}
+
+Uint8 *Soundset::convert( const char *filename, Uint32 &length )
 {
 	SDL_AudioSpec wave;
+	SDL_AudioCVT cvt;
 	Uint8 *data;
 	Uint32 dlen;
 
 	// Audio-Datei laden und nach 16 Bit und 22KHz wandeln
-	if ( SDL_LoadWAV(filename, &wave, &data, &dlen) == NULL ) {
-		std::cout << "Error in Sound: " << SDL_GetError() << std::endl;
-		exit(1);
-	}
+	if ( SDL_LoadWAV(filename, &wave, &data, &dlen) == NULL )
+		return NULL;
 
-	SDL_BuildAudioCVT( &cvt[id], wave.format, wave.channels, wave.freq, AUDIO_S16, 2, 22050 );
-	cvt[id].buf = (Uint8*)malloc( dlen*cvt[id].len_mult );
-	memcpy( cvt[id].buf, data, dlen );
+	SDL_BuildAudioCVT( &cvt, wave.format, wave.channels, wave.freq, AUDIO_S16, AUDIOCHANNELS, AUDIOFREQUENCY );
+	cvt.buf = (Uint8*)malloc( dlen*cvt.len_mult );
+	memcpy( cvt.buf, data, dlen );
 	
-	cvt[id].len = dlen;
-	SDL_ConvertAudio(&cvt[id]);
+	cvt.len = dlen;
+	SDL_ConvertAudio(&cvt);
 	SDL_FreeWAV(data);
+
+	length = cvt.len_cvt;
+
+	return cvt.buf;
 }
 
 void Soundset::mixAudio( void *, Uint8 *stream, int length )
@@ -52,11 +52,18 @@ public:
 	void toggle();
 	
 	void play( SoundId id );
+
+	// Loads a Wave-File and converts it to the Format of the Mixer.
+	// Returns a new Buffer. Free it with free(), NULL on Errors (see
+	// SDL_GetError()).
+	static Uint8 *convert( const char *filename, Uint32 &length );
 		
 private:
 	int amount;
 	SDL_AudioSpec format;
-	SDL_AudioCVT cvt[_SOUNDSETNAMES];
+	Uint8 *samples[_SOUNDSETNAMES];
+	Uint32 lengths[_SOUNDSETNAMES];
+	bool in_pack[_SOUNDSETNAMES];
 	static Sample sounds[];
 	static bool soundOn;
 		
@@ -64,7 +71,7 @@ private:
 
 	void end();
 	
-	void loadAudio( char *filename, int id );
+	void loadAudio( const char *filename, int id );
 
 	static void mixAudio( void*, Uint8 *stream, int length );
 };
@@ -0,0 +1,103 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "tasks.cpp"
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#include <sstream>
+
+#include "tasks.hpp"
+
+/******************************************************************************************
+ *
+ * Tasks
+ *
+ ******************************************************************************************/
+Tasks::Tasks( Uint32 budget )
+:
+	budget(budget),
+	next(0)
+{
+	std::ostringstream info;
+	info << "Initializing Tasks with " << budget << " ms per Frame";
+	verbose( info.str() );
+}
+
+Tasks::~Tasks()
+{
+	verbose( "Deleting Tasks" );
+}
+
+Uint32 Tasks::get_Budget() const
+{
+	return budget;
+}
+
+void Tasks::add( Task *task )
+{
+	if ( !has( task ) )
+		tasks.push_back( task );
+}
+
+void Tasks::remove( Task *task )
+{
+	for ( int i=0; i < (int)tasks.size(); i++ )
+		if ( tasks[i] == task ) {
+			tasks.erase( tasks.begin()+i );
+
+			if ( i < next )
+				next--;
+
+			return;
+		}
+}
+
+bool Tasks::has( Task *task ) const
+{
+	for ( int i=0; i < (int)tasks.size(); i++ )
+		if ( tasks[i] == task )
+			return true;
+
+	return false;
+}
+
+void Tasks::run()
+{
+	Uint32 start = SDL_GetTicks();
+
+	if ( tasks.empty() )
+		return;
+
+	// Even without Budget one Task makes one Step per Frame, so a slow
+	// Computer still gets on. The Tasks take their Steps in turn, the
+	// next Frame goes on where this one stopped.
+	do {
+		if ( next >= (int)tasks.size() )
+			next = 0;
+
+		if ( tasks[next]->step() )
+			tasks.erase( tasks.begin()+next );
+		else
+			next++;
+
+	} while ( !tasks.empty() && SDL_GetTicks()-start < budget );
+}
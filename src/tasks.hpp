@@ -0,0 +1,90 @@
+/******************************************************************************************
+ *
+ * HighMoon - Duell im All
+ * Copyright (c) 2005, 2006 Patrick Gerdsmeier <patrick@gerdsmeier.net>
+ *
+ * "tasks.hpp"
+ *
+ * Task - A long Piece of Work, done in small Steps. Its State lives
+ * in the Object, so no static Locals are needed between the Steps.
+ *
+ * Tasks - Runs Steps of all added Tasks until the Budget of the Frame
+ * is spent (see --budget). A fast Computer finishes a Task in one
+ * Frame, a slow one spreads it over many and keeps its Framerate.
+ *
+ *
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ ******************************************************************************************/
+
+#ifndef __TASKS_HPP__
+#define __TASKS_HPP__
+
+#include <vector>
+
+#include <SDL/SDL.h>
+
+#include "constants.hpp"
+
+/******************************************************************************************
+ *
+ * Task
+ *
+ ******************************************************************************************/
+class Task
+{
+public:
+	virtual ~Task() {}
+
+	// Does one small Step of the Work. Returns true when the Task is
+	// done, then it is removed from the Tasks.
+	virtual bool step() = 0;
+};
+
+/******************************************************************************************
+ *
+ * Tasks
+ *
+ ******************************************************************************************/
+class Tasks
+{
+public:
+	// budget is in ms per Frame
+	Tasks( Uint32 budget );
+
+	~Tasks();
+
+	Uint32 get_Budget() const;
+
+	// The Task stays owned by the Caller. Adding it twice does nothing.
+	void add( Task *task );
+
+	// Call it before the Task is deleted
+	void remove( Task *task );
+
+	bool has( Task *task ) const;
+
+	// Gives the Tasks Steps in turn until all Tasks are done or the
+	// Budget is spent, but at least one Step
+	void run();
+
+private:
+	std::vector<Task *> tasks;
+	Uint32 budget;
+	int next;				// Task of the next Step
+};
+
+#endif
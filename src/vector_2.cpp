@@ -28,6 +28,15 @@
 
 const double PI = 3.141592;
 
+Vector_2::Vector_2()
+:
+	x(0),
+	y(0),
+	length(0),
+	angle(0),
+	infinite(false)
+{}
+
 Vector_2::Vector_2( double a, double b, Vectortype typ )
 {
 	switch (typ) {
@@ -48,6 +48,8 @@ enum Vectortype { K, P, U };
 class Vector_2
 {
 public:
+	Vector_2();
+
 	Vector_2( double, double, Vectortype );
 
 	bool isInfinite();